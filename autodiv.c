@@ -0,0 +1,308 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// AUTODIV.C - Automatic timing divider tuning
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+#include "autodiv.h"
+#include "settings.h"
+#include "timer.h"
+#include "vgm.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint32_t autoDividerBaselineLoops = 0;
+uint16_t autoDividerISRLoad = 0;
+uint32_t autoDividerISRCost = 0;
+
+// BIOS tick counter in the BIOS data area.  The BIOS ISR8 still gets called at its normal rate while we are playing, so this stays usable as a slow reference clock.
+volatile uint32_t far *biosTickCount = (volatile uint32_t far *)0x0040006C;
+
+// Stats for the frame (screen refresh) currently being measured
+uint32_t autoDividerFrameStart = 0;
+uint32_t autoDividerFrameLateness = 0;
+uint32_t autoDividerFramePass = 0;
+uint8_t autoDividerLateFrames = 0;
+
+// Stats for the song currently playing
+uint32_t autoDividerPassSum = 0;
+uint32_t autoDividerFrames = 0;
+uint32_t autoDividerWorstLateness = 0;
+uint32_t autoDividerWorstStage[3];	// processCommands / drawChannelTable / updateLevelBars
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+uint32_t autoDividerCountLoops(void)
+{
+	uint32_t loops = 0;
+	uint32_t start;
+
+	// Wait for a fresh BIOS tick so we always measure whole ticks
+	start = *biosTickCount;
+	while (*biosTickCount == start)
+	{
+	}
+	// Spin and count until enough ticks have passed.  Whatever time the interrupts steal is time we don't spend counting!
+	start = *biosTickCount;
+	while ((*biosTickCount - start) < AUTO_DIVIDER_CALIBRATION_TICKS)
+	{
+		loops++;
+	}
+	return loops;
+}
+
+void autoDividerLog(char* reason)
+{
+	FILE *logFilePointer;
+
+	logFilePointer = fopen(settings.logPath, "at");
+	if (logFilePointer == NULL)
+	{
+		// Logging is nice to have, not a reason to stop the music
+		return;
+	}
+	fprintf(logFilePointer, "%s: ISR load %u.%u%%, worst late %lu, stages %lu/%lu/%lu ticks -> DIVIDER %u (%s)\n",
+		vgmFileName,
+		autoDividerISRLoad / 10, autoDividerISRLoad % 10,
+		autoDividerWorstLateness,
+		autoDividerWorstStage[0], autoDividerWorstStage[1], autoDividerWorstStage[2],
+		playbackFrequencyDivider,
+		reason);
+	fclose(logFilePointer);
+}
+
+void autoDividerResetStats(void)
+{
+	autoDividerPassSum = 0;
+	autoDividerFrames = 0;
+	autoDividerWorstLateness = 0;
+	autoDividerWorstStage[0] = 0;
+	autoDividerWorstStage[1] = 0;
+	autoDividerWorstStage[2] = 0;
+	autoDividerFrameStart = tickCounter;
+	autoDividerFrameLateness = 0;
+	autoDividerFramePass = 0;
+	autoDividerLateFrames = 0;
+}
+
+void autoDividerCalibrate(void)
+{
+	autoDividerBaselineLoops = autoDividerCountLoops();
+}
+
+void autoDividerMeasureISR(void)
+{
+	uint32_t loops;
+
+	// Too slow to count anything meaningful (or calibration never happened) - assume no load
+	if (autoDividerBaselineLoops < 1000)
+	{
+		autoDividerISRLoad = 0;
+		autoDividerISRCost = 0;
+		return;
+	}
+	loops = autoDividerCountLoops();
+	// Compare against the baseline.  Dividing the baseline down first keeps this from overflowing on fast machines.
+	loops = loops / (autoDividerBaselineLoops / 1000);
+	if (loops > 1000)
+	{
+		loops = 1000;
+	}
+	autoDividerISRLoad = 1000 - (uint16_t)loops;
+	autoDividerISRCost = (uint32_t)autoDividerISRLoad * playbackFrequencyDivider;
+}
+
+void autoDividerPass(uint32_t lateness, uint32_t processTicks, uint32_t drawTicks, uint32_t barTicks)
+{
+	uint32_t passTicks = processTicks + drawTicks + barTicks;
+	uint32_t work;
+
+	// A pass that started late spends its command processing catching up on the backlog.  How long that takes depends on how far behind we
+	// already were, not on how much work the song is, so counting it would make the work look bigger the worse things get.  Only its screen work counts.
+	if (lateness > AUTO_DIVIDER_MAX_LATENESS)
+	{
+		passTicks = drawTicks + barTicks;
+	}
+
+	// Track the worst of everything within this frame
+	if (lateness > autoDividerFrameLateness)
+	{
+		autoDividerFrameLateness = lateness;
+	}
+	if (passTicks > autoDividerFramePass)
+	{
+		autoDividerFramePass = passTicks;
+	}
+	if (processTicks > autoDividerWorstStage[0])
+	{
+		autoDividerWorstStage[0] = processTicks;
+	}
+	if (drawTicks > autoDividerWorstStage[1])
+	{
+		autoDividerWorstStage[1] = drawTicks;
+	}
+	if (barTicks > autoDividerWorstStage[2])
+	{
+		autoDividerWorstStage[2] = barTicks;
+	}
+
+	// Roll up once per screen refresh
+	if ((tickCounter - autoDividerFrameStart) >= VGA_REFRESH_TICKS)
+	{
+		autoDividerFrameStart = tickCounter;
+		autoDividerPassSum += autoDividerFramePass;
+		autoDividerFrames++;
+		if (autoDividerFrameLateness > autoDividerWorstLateness)
+		{
+			autoDividerWorstLateness = autoDividerFrameLateness;
+		}
+
+		// Count how many frames in a row we've been too late
+		if (autoDividerFrameLateness > AUTO_DIVIDER_MAX_LATENESS)
+		{
+			autoDividerLateFrames++;
+		}
+		else
+		{
+			autoDividerLateFrames = 0;
+		}
+		autoDividerFrameLateness = 0;
+		autoDividerFramePass = 0;
+
+		// We've been behind for a while - don't wait for the next song to fix it.
+		// Only if a bigger divider would actually help, though.  If the main loop itself is too slow, fewer interrupts won't save it, and the timing only gets coarser.
+		if (autoDividerLateFrames >= AUTO_DIVIDER_ESCALATE_FRAMES && playbackFrequencyDivider < 255)
+		{
+			work = autoDividerWork();
+			if (autoDividerPredict(playbackFrequencyDivider + 1, work) < autoDividerPredict(playbackFrequencyDivider, work))
+			{
+				autoDividerSetDivider(playbackFrequencyDivider + 1);
+				autoDividerLog("running late, raised mid-song");
+				autoDividerResetStats();
+			}
+			else
+			{
+				autoDividerLateFrames = 0;
+			}
+		}
+	}
+}
+
+uint32_t autoDividerWork(void)
+{
+	uint32_t averagePass;
+
+	if (autoDividerFrames == 0)
+	{
+		return 0;
+	}
+	// The worst pass of each frame, averaged over the song, so one-off spikes (like a 4-op layout redraw) don't skew things
+	averagePass = autoDividerPassSum / autoDividerFrames;
+	// Take out the time the interrupt stole, leaving how much work the main loop actually does
+	return (averagePass * (1000 - autoDividerISRLoad)) / 1000;
+}
+
+uint32_t autoDividerPredict(uint16_t divider, uint32_t work)
+{
+	uint32_t load;
+
+	// The interrupt load scales with how often it fires
+	load = autoDividerISRCost / divider;
+	if (load >= AUTO_DIVIDER_MAX_LOAD)
+	{
+		return 0xFFFFFFFFUL;
+	}
+	// The main loop's work gets stretched by whatever the interrupt takes, and a command can also be up to one divider's worth of ticks late just from the coarser timing
+	return divider + ((work * 1000) / (1000 - load));
+}
+
+void autoDividerSetDivider(uint8_t divider)
+{
+	// Worked out from the divider 1 figure each time, so rounding doesn't build up as the divider goes up and down
+	autoDividerISRLoad = (uint16_t)(autoDividerISRCost / divider);
+	setTimerDivider(divider);
+}
+
+uint8_t autoDividerRetune(void)
+{
+	uint32_t work;
+	uint32_t predicted;
+	uint32_t closest = 0xFFFFFFFFUL;
+	uint16_t divider;
+	uint16_t closestDivider = playbackFrequencyDivider;
+	uint8_t onTime = FALSE;
+
+	// Nothing measured yet (first song) - stick with what we've got
+	if (autoDividerFrames == 0)
+	{
+		return playbackFrequencyDivider;
+	}
+	work = autoDividerWork();
+
+	// Find the smallest divider where the interrupt leaves enough CPU for the main loop to stay on time.
+	// If none of them can, the machine is just too slow for this much screen - go with whichever gets closest, rather than all the way up.
+	for (divider = 1; divider < 255; divider++)
+	{
+		predicted = autoDividerPredict(divider, work);
+		if (predicted <= AUTO_DIVIDER_MAX_LATENESS)
+		{
+			closestDivider = divider;
+			onTime = TRUE;
+			break;
+		}
+		if (predicted < closest)
+		{
+			closest = predicted;
+			closestDivider = divider;
+		}
+	}
+	divider = closestDivider;
+	// Songs don't all take the same amount of drawing, so when it's about the best we can do anyway, stay put instead of wandering around between songs
+	if (onTime == FALSE && autoDividerPredict(playbackFrequencyDivider, work) <= closest + AUTO_DIVIDER_HYSTERESIS)
+	{
+		divider = playbackFrequencyDivider;
+	}
+
+	// The model is only an estimate - if we were actually late at the current divider, don't go any lower than one step above it (as long as that step still helps)
+	if (autoDividerWorstLateness > AUTO_DIVIDER_MAX_LATENESS && divider <= playbackFrequencyDivider && playbackFrequencyDivider < 255
+		&& autoDividerPredict(playbackFrequencyDivider + 1, work) < autoDividerPredict(playbackFrequencyDivider, work))
+	{
+		divider = playbackFrequencyDivider + 1;
+	}
+
+	// A song that fell badly behind can make the work look far bigger than it is - the main loop can get stuck catching up for seconds at a time.
+	// So only go up a few steps at a time, and let the next song (measured at a divider that copes better) say whether it needs to go further.
+	if (divider > ((uint16_t)playbackFrequencyDivider * AUTO_DIVIDER_MAX_RAISE))
+	{
+		divider = (uint16_t)playbackFrequencyDivider * AUTO_DIVIDER_MAX_RAISE;
+	}
+
+	if (divider != playbackFrequencyDivider)
+	{
+		// The timer has to be reprogrammed too, or the next song would count ticks at the new divider while they still come in at the old rate
+		autoDividerSetDivider((uint8_t)divider);
+		autoDividerLog("retuned for next song");
+	}
+	else
+	{
+		autoDividerLog("kept for next song");
+	}
+	autoDividerResetStats();
+	return playbackFrequencyDivider;
+}
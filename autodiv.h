@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// AUTODIV.H - Automatic timing divider tuning
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_AUTODIV_H
+#define VGMSLAP_AUTODIV_H
+
+#include "types.h"
+
+// How late (in 44100hz ticks) a command is allowed to be before we consider the machine to be struggling.  441 ticks = 10ms
+#define AUTO_DIVIDER_MAX_LATENESS 441
+
+// How many screen refreshes in a row have to be late before the divider is bumped up in the middle of a song (35 = about a second)
+#define AUTO_DIVIDER_ESCALATE_FRAMES 35
+
+// When no divider can keep up, how much less late (in ticks) another one has to look before we bother switching to it
+#define AUTO_DIVIDER_HYSTERESIS 20
+
+// The most one retune between songs can multiply the divider by
+#define AUTO_DIVIDER_MAX_RAISE 2
+
+// Never pick a divider where the timer interrupt would eat more than this much of the CPU (in tenths of a percent)
+#define AUTO_DIVIDER_MAX_LOAD 900
+
+// How many BIOS clock ticks (18.2hz) to spend counting loops when measuring the interrupt load
+#define AUTO_DIVIDER_CALIBRATION_TICKS 2
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void autoDividerCalibrate(void);	// Count idle loops with the PIT at its normal rate - this is our "100% CPU available" baseline
+void autoDividerMeasureISR(void);	// Count idle loops again with our timer running to find out how much the interrupt costs
+
+// Record one pass of the main loop: how late the next command was, and how long each stage took (all in ticks)
+void autoDividerPass(uint32_t lateness, uint32_t processTicks, uint32_t drawTicks, uint32_t barTicks);
+
+uint8_t autoDividerRetune(void);	// Pick the divider for the next song based on what was measured, and log the decision
+
+uint32_t autoDividerCountLoops(void);	// Spin for a fixed number of BIOS ticks and return how many loops we managed
+void autoDividerLog(char* reason);		// Append the current decision and stats to the log file
+void autoDividerResetStats(void);		// Clear the per-song measurements
+uint32_t autoDividerWork(void);		// How many ticks the main loop's worst pass per frame takes, without the interrupt's share
+uint32_t autoDividerPredict(uint16_t divider, uint32_t work);	// How late (in ticks) the load model expects commands to be at a divider
+void autoDividerSetDivider(uint8_t divider);	// Reprogram the timer for a new divider, keeping the interrupt load estimate in step
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint32_t autoDividerBaselineLoops;	// Idle loop count with no fast timer
+extern uint16_t autoDividerISRLoad;			// Share of the CPU used by the timer interrupt at the current divider (tenths of a percent)
+extern uint32_t autoDividerISRCost;			// What that would be at divider 1 (can be over 1000, if the machine couldn't even keep up)
+
+#endif
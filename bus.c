@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// BUS.C - OPL port access, timed against the PIT instead of spin delays
+//
+// Only the timing rules live here.  The actual PIT and port access is in
+// BUSIO.C, behind busClock/busPortWrite/busPortRead, so this file builds on
+// its own and TESTS\TBUS.C can check the rules against a pretend clock.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "bus.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint16_t (*busClock)(void) = busHardwareClock;
+void (*busPortWrite)(uint16_t port, uint8_t data) = busHardwarePortWrite;
+uint8_t (*busPortRead)(uint16_t port) = busHardwarePortRead;
+uint16_t busLastAccess[2] = {0, 0};
+uint8_t busGap[2] = {0, 0};
+uint32_t busAccesses = 0;
+uint32_t busWaits = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void busWrite(uint8_t chip, uint16_t port, uint8_t data, uint8_t gap)
+{
+	// The time comes from just before the write, so the gap starts a hair early - the delays in detectOPL have enough slack to cover it
+	busLastAccess[chip] = busWait(chip);
+	busPortWrite(port, data);
+	busGap[chip] = gap;
+	busAccesses++;
+}
+
+uint8_t busRead(uint8_t chip, uint16_t port)
+{
+	busWait(chip);
+	busAccesses++;
+	return busPortRead(port);
+}
+
+uint16_t busWait(uint8_t chip)
+{
+	uint16_t now = busClock();
+	uint8_t spins = 0;
+
+	// The old way was to spin on inp(0x80) for the whole gap after every write, no matter what happened in between.
+	// Now the gap starts counting at the write, and whatever the player gets up to before the next one (parsing the VGM, queueing UI updates) counts towards it.
+	// Only the part that's left, if any, gets waited out here.
+	// The clock counts down, so time passed is last minus now - and unsigned math takes care of the wrap.
+	if (busGap[chip] != 0)
+	{
+		if ((uint16_t)(busLastAccess[chip] - now) < busGap[chip])
+		{
+			busWaits++;
+			while ((uint16_t)(busLastAccess[chip] - now) < busGap[chip])
+			{
+				now = busClock();
+				// Every clock read is a few bus cycles, so if 256 of them haven't covered a 30us gap the clock isn't running.  Don't hang over it.
+				if (++spins == 0)
+				{
+					break;
+				}
+			}
+		}
+		busGap[chip] = 0;
+	}
+	return now;
+}
@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// BUS.H - OPL port access, timed against the PIT instead of spin delays
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_BUS_H
+#define VGMSLAP_BUS_H
+
+#include "types.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// BUS.C
+void busWrite(uint8_t chip, uint16_t port, uint8_t data, uint8_t gap);	// Write a port once the chip is ready, then note how long the chip needs before the next access
+uint8_t busRead(uint8_t chip, uint16_t port);				// Read a port once the chip is ready
+uint16_t busWait(uint8_t chip);								// Wait out whatever is left of the chip's last gap, and return the time
+
+// BUSIO.C
+void busInit(void);											// Start PIT channel 2 running freely, to use as the bus clock
+void busClose(void);										// Put channel 2 and the speaker gate back the way we found them
+uint16_t busHardwareClock(void);							// Read PIT channel 2
+void busHardwarePortWrite(uint16_t port, uint8_t data);		// outp()
+uint8_t busHardwarePortRead(uint16_t port);					// inp()
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint16_t (*busClock)(void);						// Where the time comes from - counts DOWN at 1193182hz, wrapping every 55ms
+extern void (*busPortWrite)(uint16_t port, uint8_t data);	// Where port writes go
+extern uint8_t (*busPortRead)(uint16_t port);			// Where port reads come from
+extern uint8_t busActive;								// Set once busInit has started channel 2
+extern uint8_t busSpeakerGate;							// Port 61h as it was before busInit
+extern uint16_t busLastAccess[2];						// Clock reading when each chip was last accessed (two for dual OPL2)
+extern uint8_t busGap[2];								// PIT ticks each chip needs after its last access, 0 once it's been waited out
+extern uint32_t busAccesses;							// Total port accesses
+extern uint32_t busWaits;								// Accesses that found the chip still busy and had to wait
+
+#endif
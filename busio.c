@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// BUSIO.C - The PIT channel 2 clock and the OPL ports themselves, for BUS.C
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <conio.h>
+
+#include "bus.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t busActive = FALSE;
+uint8_t busSpeakerGate = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void busInit(void)
+{
+	// Nothing to start if it's already going
+	if (busActive == TRUE)
+	{
+		return;
+	}
+	// Channel 2 is the PC speaker's timer, and nothing else in VGMSlap uses it.
+	// Open its gate (bit 0) but keep the speaker itself disconnected (bit 1) so it counts silently.
+	busSpeakerGate = inp(0x61);
+	outp(0x61, (busSpeakerGate & 0xFC) | 0x01);
+	// Channel 2, low then high byte, mode 2 (rate generator), binary.  A reload of 0 means 65536, so it just counts down forever.
+	outp(0x43, 0xB4);
+	outp(0x42, 0x00);
+	outp(0x42, 0x00);
+	busActive = TRUE;
+}
+
+void busClose(void)
+{
+	if (busActive == FALSE)
+	{
+		return;
+	}
+	outp(0x61, busSpeakerGate);
+	busActive = FALSE;
+}
+
+uint16_t busHardwareClock(void)
+{
+	uint8_t low;
+	uint8_t high;
+
+	// Latch channel 2's count, then read it out low byte first
+	outp(0x43, 0x80);
+	low = inp(0x42);
+	high = inp(0x42);
+	return ((uint16_t)high << 8) | low;
+}
+
+void busHardwarePortWrite(uint16_t port, uint8_t data)
+{
+	outp(port, data);
+}
+
+uint8_t busHardwarePortRead(uint16_t port)
+{
+	return inp(port);
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// CELLS.C - Ready-made screen cells for every value the channel table shows
+//
+// The channel table used to sprintf each hex number into txtDrawBuffer and
+// then draw the string, every time a register changed.  sprintf is a lot of
+// work for three characters on an 8088.  There aren't that many values any
+// one field can have, so they all get turned into cells (character and
+// color) once at startup, and drawing one is just copying a few words.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "cells.h"
+#include "txtgfx.h"
+#include "txtmode.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint16_t far cellFrequency[1024][CELLS_FREQUENCY];
+uint16_t far cellBlock[8][CELLS_BLOCK];
+uint16_t far cellOutputLevel[2][64][CELLS_OUTPUT_LEVEL];
+uint16_t far cellWaveform[2][8][CELLS_WAVEFORM];
+uint16_t far cellKSL[2][4][CELLS_KSL];
+uint16_t far cellMultiplier[2][16][CELLS_MULTIPLIER];
+uint16_t far cellFeedback[8][CELLS_FEEDBACK];
+uint16_t far cellChannelName[18][CELLS_CHANNEL_NAME];
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void buildCellTemplates(void)
+{
+	uint16_t i;
+	uint8_t op;
+	uint8_t color;
+	char text[6];
+
+	// Frequency number and block, which are the same for every channel
+	for (i = 0; i < 1024; i++)
+	{
+		text[0] = numToHex[(i >> 8) & 0x0F];
+		text[1] = numToHex[(i >> 4) & 0x0F];
+		text[2] = numToHex[i & 0x0F];
+		buildCells(cellFrequency[i], text, CELLS_FREQUENCY, COLOR_YELLOW, COLOR_BLACK);
+	}
+	for (i = 0; i < 8; i++)
+	{
+		text[0] = ' ';
+		text[1] = numToHex[i];
+		text[2] = ' ';
+		buildCells(cellBlock[i], text, CELLS_BLOCK, COLOR_BROWN, COLOR_BLACK);
+		buildCells(cellFeedback[i], oplFeedbackNames[i], CELLS_FEEDBACK, COLOR_YELLOW, COLOR_BLACK);
+	}
+
+	// Operator values, in both operators' colors (same as drawOperatorFields picks)
+	for (op = 0; op < 2; op++)
+	{
+		color = (op == 0) ? COLOR_LIGHTCYAN : COLOR_LIGHTGREEN;
+		for (i = 0; i < 64; i++)
+		{
+			text[0] = numToHex[i >> 4];
+			text[1] = numToHex[i & 0x0F];
+			buildCells(cellOutputLevel[op][i], text, CELLS_OUTPUT_LEVEL, color, COLOR_BLACK);
+		}
+		for (i = 0; i < 8; i++)
+		{
+			buildCells(cellWaveform[op][i], oplWaveformNames[i], CELLS_WAVEFORM, color, COLOR_BLACK);
+		}
+		for (i = 0; i < 4; i++)
+		{
+			buildCells(cellKSL[op][i], oplKSLNames[i], CELLS_KSL, color, COLOR_BLACK);
+		}
+		for (i = 0; i < 16; i++)
+		{
+			buildCells(cellMultiplier[op][i], oplMultiplierNames[i], CELLS_MULTIPLIER, color, COLOR_BLACK);
+		}
+	}
+
+	// Channel headers, "Ch.01" to "Ch.18"
+	for (i = 0; i < 18; i++)
+	{
+		text[0] = 'C';
+		text[1] = 'h';
+		text[2] = '.';
+		text[3] = '0' + ((i + 1) / 10);
+		text[4] = '0' + ((i + 1) % 10);
+		buildCells(cellChannelName[i], text, CELLS_CHANNEL_NAME, COLOR_WHITE, COLOR_BLACK);
+	}
+}
+
+void buildCells(uint16_t far *cells, const char *text, uint8_t count, uint8_t foregroundColor, uint8_t backgroundColor)
+{
+	// Same way drawStringAtPosition puts a cell together
+	uint16_t attribute = (uint16_t)(foregroundColor | (backgroundColor << 4)) << 8;
+	uint8_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		cells[i] = (uint8_t)text[i] | attribute;
+	}
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// CELLS.H - Ready-made screen cells for every value the channel table shows
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_CELLS_H
+#define VGMSLAP_CELLS_H
+
+#include "types.h"
+
+// How many cells wide each value is on screen
+#define CELLS_FREQUENCY 3		// "%.3X"
+#define CELLS_BLOCK 3			// " %X "
+#define CELLS_OUTPUT_LEVEL 2	// "%.2X"
+#define CELLS_WAVEFORM 4		// oplWaveformNames
+#define CELLS_KSL 3				// oplKSLNames
+#define CELLS_MULTIPLIER 1		// oplMultiplierNames
+#define CELLS_FEEDBACK 2		// oplFeedbackNames
+#define CELLS_CHANNEL_NAME 5	// "Ch.%02d"
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void buildCellTemplates(void);	// Fill in all of the cell tables, once at startup
+void buildCells(uint16_t far *cells, const char *text, uint8_t count, uint8_t foregroundColor, uint8_t backgroundColor);	// Turn count characters of text into cells with the given colors
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// Character in the low byte and attribute in the high, same as textBackBuffer, so they can go straight in with drawCellsAtPosition.
+// The ones with an operator index come in the first operator's color (cyan) and the second's (green).
+extern uint16_t far cellFrequency[1024][CELLS_FREQUENCY];			// Frequency number, in yellow
+extern uint16_t far cellBlock[8][CELLS_BLOCK];						// Block number, in brown
+extern uint16_t far cellOutputLevel[2][64][CELLS_OUTPUT_LEVEL];		// Output level, for each operator
+extern uint16_t far cellWaveform[2][8][CELLS_WAVEFORM];				// Waveform, for each operator
+extern uint16_t far cellKSL[2][4][CELLS_KSL];						// Key scale level, for each operator
+extern uint16_t far cellMultiplier[2][16][CELLS_MULTIPLIER];		// Frequency multiplier, for each operator
+extern uint16_t far cellFeedback[8][CELLS_FEEDBACK];				// Feedback, in yellow
+extern uint16_t far cellChannelName[18][CELLS_CHANNEL_NAME];		// Channel headers, in white
+
+#endif
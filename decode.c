@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// DECODE.C - Turn changed OPL registers into oplStatus
+//
+// Works through the registers writeOPL queued up and sorts out what they mean
+// for each channel, without drawing anything.  drawChannelTable then only has
+// to look at which fields of which channels changed.  Since nothing here
+// touches the screen, it can keep up with the writes as they happen, and
+// anything else that wants to know what the chip is doing can use it too.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stddef.h>
+
+#include "decode.h"
+#include "opl.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// Every register the display cares about, and where it goes.  Registers with more than one field get a row for each.
+// Kept in register order so the search can stop early (0x104 and 0x105 are 0x04 and 0x05 of the second bank).
+const decodeField decodeFields[] = {
+	{0x04, 0x04, DECODE_BANK_1, DECODE_TARGET_4OP, 0, 0, 0, 0},
+	{0x05, 0x05, DECODE_BANK_1, DECODE_TARGET_OPL3, 0, 0, 0, 0},
+	{0x20, 0x35, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, frequencyMultiplierFactor), 0, 0x0F, DECODE_OP1_FLAGS},
+	{0x20, 0x35, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, flagTremolo), 7, 0x01, DECODE_OP1_FLAGS},
+	{0x20, 0x35, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, flagFrequencyVibrato), 6, 0x01, DECODE_OP1_FLAGS},
+	{0x20, 0x35, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, flagSoundSustaining), 5, 0x01, DECODE_OP1_FLAGS},
+	{0x20, 0x35, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, flagKSR), 4, 0x01, DECODE_OP1_FLAGS},
+	{0x40, 0x55, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, keyScaleLevel), 6, 0x03, DECODE_OP1_LEVEL},
+	{0x40, 0x55, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, outputLevel), 0, 0x3F, DECODE_OP1_LEVEL},
+	{0x60, 0x75, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, attackRate), 4, 0x0F, DECODE_OP1_ATTACK},
+	{0x60, 0x75, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, decayRate), 0, 0x0F, DECODE_OP1_ATTACK},
+	{0x80, 0x95, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, sustainLevel), 4, 0x0F, DECODE_OP1_SUSTAIN},
+	{0x80, 0x95, DECODE_BANK_BOTH, DECODE_TARGET_OPERATOR, offsetof(oplOperator, releaseRate), 0, 0x0F, DECODE_OP1_SUSTAIN},
+	{0xA0, 0xA8, DECODE_BANK_BOTH, DECODE_TARGET_FREQUENCY, 0, 0, 0, DECODE_FREQUENCY},
+	{0xB0, 0xB8, DECODE_BANK_BOTH, DECODE_TARGET_FREQUENCY, 0, 0, 0, DECODE_KEY},
+	{0xB0, 0xB8, DECODE_BANK_BOTH, DECODE_TARGET_KEY, offsetof(oplChannel, blockNumber), 2, 0x07, DECODE_KEY},
+	{0xBD, 0xBD, DECODE_BANK_0, DECODE_TARGET_RHYTHM, 0, 0, 0, 0},
+	{0xC0, 0xC8, DECODE_BANK_BOTH, DECODE_TARGET_CHANNEL, offsetof(oplChannel, panning), 4, 0x03, DECODE_ALGORITHM},
+	{0xC0, 0xC8, DECODE_BANK_BOTH, DECODE_TARGET_CHANNEL, offsetof(oplChannel, feedback), 1, 0x07, DECODE_ALGORITHM},
+	{0xC0, 0xC8, DECODE_BANK_BOTH, DECODE_TARGET_CHANNEL, offsetof(oplChannel, synthesisType), 0, 0x01, DECODE_ALGORITHM},
+	{0xE0, 0xF5, DECODE_BANK_BOTH, DECODE_TARGET_WAVEFORM, offsetof(oplOperator, waveform), 0, 0x07, DECODE_OP1_WAVEFORM},
+	{0xFF, 0x00, 0, 0, 0, 0, 0, 0}
+};
+
+uint16_t decodeChannelChanges[18];
+uint8_t decodeChangedChannels[18];
+uint8_t decodeChangedCount = 0;
+uint8_t decodeGlobalChanges = 0;
+uint32_t decodeRegisterCount = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void decodeOPLChanges(void)
+{
+	uint16_t offset;
+	uint16_t queueEnd;
+
+	// Anything the timer interrupt adds while we're in here is left for next time
+	queueEnd = oplChangeTail;
+	while (oplChangeHead != queueEnd)
+	{
+		offset = oplChangeQueue[oplChangeHead];
+		oplChangeHead = (oplChangeHead + 1) & (OPL_CHANGE_QUEUE_SIZE - 1);
+		// Taken off the queue, so a new write to it can go back on
+		oplChangeMap[offset] = 0;
+		decodeOPLRegister(offset);
+		decodeRegisterCount++;
+	}
+}
+
+void decodeOPLRegister(uint16_t offset)
+{
+	const decodeField *row;
+	uint8_t reg = (uint8_t)(offset & 0xFF);
+	uint8_t bank = (uint8_t)(offset >> 8);
+	uint8_t value = oplRegisterMap[offset];
+	uint8_t targetChannel;
+	uint8_t targetOperator;
+	uint8_t j;
+
+	// An OPL2 only has the first bank
+	if (bank > 0 && maxChannels <= 9)
+	{
+		return;
+	}
+
+	// The last row has no banks, to stop on
+	for (row = &decodeFields[0]; row->firstRegister <= reg && row->banks != 0; row++)
+	{
+		if (reg > row->lastRegister || (row->banks & (1 << bank)) == 0)
+		{
+			continue;
+		}
+
+		switch (row->target)
+		{
+			case DECODE_TARGET_OPERATOR:
+			case DECODE_TARGET_WAVEFORM:
+				// The gaps in the operator offsets (0x06, 0x07, 0x0E, 0x0F) don't belong to any operator
+				if (((reg - row->firstRegister) & 0x07) >= 0x06)
+				{
+					return;
+				}
+				targetChannel = oplOperatorToChannel[reg - row->firstRegister] + (bank * 9);
+				targetOperator = oplOffsetToOperator[reg - row->firstRegister];
+				// If OPL2, ignore the highest bit of the waveform as those can't be used
+				if (row->target == DECODE_TARGET_WAVEFORM && oplStatus.flagOPL3Mode == 0)
+				{
+					((uint8_t*)&oplStatus.channels[targetChannel].operators[targetOperator])[row->member] = (value >> row->shift) & (row->mask & 0x03);
+				}
+				else
+				{
+					((uint8_t*)&oplStatus.channels[targetChannel].operators[targetOperator])[row->member] = (value >> row->shift) & row->mask;
+				}
+				decodeMarkChannel(targetChannel, row->field << (targetOperator * DECODE_OP2_SHIFT));
+				break;
+
+			case DECODE_TARGET_CHANNEL:
+				targetChannel = (reg - row->firstRegister) + (bank * 9);
+				((uint8_t*)&oplStatus.channels[targetChannel])[row->member] = (value >> row->shift) & row->mask;
+				decodeMarkChannel(targetChannel, row->field);
+				break;
+
+			case DECODE_TARGET_FREQUENCY:
+				// Frequency number is split between the two, so either one needs the whole thing put back together
+				targetChannel = (reg - row->firstRegister) + (bank * 9);
+				oplStatus.channels[targetChannel].frequencyNumber = oplRegisterMap[(bank << 8) + 0xA0 + (reg & 0x0F)] + ((oplRegisterMap[(bank << 8) + 0xB0 + (reg & 0x0F)] & 0x03) << 8);
+				decodeMarkChannel(targetChannel, row->field);
+				break;
+
+			case DECODE_TARGET_KEY:
+				targetChannel = (reg - row->firstRegister) + (bank * 9);
+				oplStatus.channels[targetChannel].blockNumber = (value >> row->shift) & row->mask;
+				// Don't actually use the keyOn value for channels 7-9 if percussion mode is activated
+				if (targetChannel < 6 || targetChannel > 8 || oplStatus.flagPercussionMode == FALSE)
+				{
+					oplStatus.channels[targetChannel].keyOn = ((value >> 5) & 0x01);
+				}
+				decodeMarkChannel(targetChannel, row->field);
+				break;
+
+			case DECODE_TARGET_RHYTHM:
+				oplStatus.tremoloDepth = (value >> 7) & 0x01;
+				oplStatus.frequencyVibratoDepth = (value >> 6) & 0x01;
+				oplStatus.flagPercussionMode = (value >> 5) & 0x01;
+				// Store value of which percussion instruments are keyed-on
+				oplStatus.percussionData = value & 0x1F;
+
+				// Based on which percussion is on, turn on the appropriate key-on for channels 7/8/9
+				// BD
+				oplStatus.channels[6].keyOn = (oplStatus.percussionData >> 4) & 0x01;
+				// SD & HH
+				oplStatus.channels[7].keyOn = ((oplStatus.percussionData >> 3) & 0x01) | (oplStatus.percussionData & 0x01);
+				// TT & CY
+				oplStatus.channels[8].keyOn = ((oplStatus.percussionData >> 2) & 0x01) | ((oplStatus.percussionData >> 1) & 0x01);
+				// Then have another look at their own key-ons, which win again if percussion mode just went off
+				for (j = 0x06; j <= 0x08; j++)
+				{
+					decodeOPLRegister(0xB0 + j);
+				}
+				decodeGlobalChanges |= DECODE_GLOBAL_RHYTHM;
+				break;
+
+			case DECODE_TARGET_4OP:
+				oplStatus.channels[0].flag4Op = (value & 0x01);
+				oplStatus.channels[3].flag4Op = (value & 0x01);
+				oplStatus.channels[1].flag4Op = (value & 0x02) >> 1;
+				oplStatus.channels[4].flag4Op = (value & 0x02) >> 1;
+				oplStatus.channels[2].flag4Op = (value & 0x04) >> 2;
+				oplStatus.channels[5].flag4Op = (value & 0x04) >> 2;
+				oplStatus.channels[9].flag4Op = (value & 0x08) >> 3;
+				oplStatus.channels[12].flag4Op = (value & 0x08) >> 3;
+				oplStatus.channels[10].flag4Op = (value & 0x10) >> 4;
+				oplStatus.channels[13].flag4Op = (value & 0x10) >> 4;
+				oplStatus.channels[11].flag4Op = (value & 0x20) >> 5;
+				oplStatus.channels[14].flag4Op = (value & 0x20) >> 5;
+				// Where everything goes on screen is up to the drawing side
+				decodeGlobalChanges |= DECODE_GLOBAL_4OP;
+				break;
+
+			case DECODE_TARGET_OPL3:
+				oplStatus.flagOPL3Mode = (value & 0x01);
+				// Waveforms 4-7 only exist in OPL3 mode, so those need another look
+				for (j = 0x00; j <= 0x15; j++)
+				{
+					decodeOPLRegister(0xE0 + j);
+					decodeOPLRegister(0x1E0 + j);
+				}
+				// Panning only shows up in OPL3 mode
+				for (j = 0; j < 18; j++)
+				{
+					decodeMarkChannel(j, DECODE_ALGORITHM);
+				}
+				decodeGlobalChanges |= DECODE_GLOBAL_OPL3;
+				break;
+		}
+	}
+}
+
+void decodeMarkChannel(uint8_t channel, uint16_t fields)
+{
+	if (decodeChannelChanges[channel] == 0)
+	{
+		decodeChangedChannels[decodeChangedCount] = channel;
+		decodeChangedCount++;
+	}
+	decodeChannelChanges[channel] |= fields;
+}
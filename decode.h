@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// DECODE.H - Turn changed OPL registers into oplStatus
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_DECODE_H
+#define VGMSLAP_DECODE_H
+
+#include "types.h"
+
+// Which parts of a channel changed, as bits in decodeChannelChanges.  The second operator's are the first's shifted up by DECODE_OP2_SHIFT.
+#define DECODE_OP1_FLAGS 0x0001		// Tremolo / vibrato / sustain / KSR and multiplier (0x20)
+#define DECODE_OP1_LEVEL 0x0002		// Key scale level and output level (0x40)
+#define DECODE_OP1_ATTACK 0x0004	// Attack and decay (0x60)
+#define DECODE_OP1_SUSTAIN 0x0008	// Sustain level and release (0x80)
+#define DECODE_OP1_WAVEFORM 0x0010	// Waveform (0xE0)
+#define DECODE_OP2_SHIFT 5
+#define DECODE_FREQUENCY 0x0400		// Frequency low byte (0xA0)
+#define DECODE_KEY 0x0800			// Key-on, block and frequency high bits (0xB0)
+#define DECODE_ALGORITHM 0x1000		// Panning, feedback and algorithm (0xC0)
+#define DECODE_ALL_FIELDS 0x1FFF	// All of the above, both operators
+
+// Chip-wide changes, as bits in decodeGlobalChanges
+#define DECODE_GLOBAL_4OP 0x01		// 4-op pairings (0x104)
+#define DECODE_GLOBAL_OPL3 0x02		// OPL3 mode (0x105)
+#define DECODE_GLOBAL_RHYTHM 0x04	// Percussion mode, tremolo and vibrato depth (0xBD)
+
+// How a row of decodeFields is put into oplStatus
+#define DECODE_TARGET_OPERATOR 0	// Bits of the register go straight into an oplOperator member
+#define DECODE_TARGET_CHANNEL 1		// Bits of the register go straight into an oplChannel member
+#define DECODE_TARGET_WAVEFORM 2	// Like an operator, but only the OPL2 waveforms unless OPL3 mode is on
+#define DECODE_TARGET_FREQUENCY 3	// Frequency number, which is split between 0xA0 and 0xB0
+#define DECODE_TARGET_KEY 4			// Key-on and block, which percussion mode can take over
+#define DECODE_TARGET_RHYTHM 5		// 0xBD
+#define DECODE_TARGET_4OP 6			// 0x104
+#define DECODE_TARGET_OPL3 7		// 0x105
+
+// Which register banks a row of decodeFields is for
+#define DECODE_BANK_0 0x01
+#define DECODE_BANK_1 0x02
+#define DECODE_BANK_BOTH 0x03
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void decodeOPLChanges(void);			// Take everything off oplChangeQueue and put it into oplStatus, noting which fields changed
+void decodeOPLRegister(uint16_t offset);	// Put one of the displayed chip's registers (0x000-0x1FF) into oplStatus
+void decodeMarkChannel(uint8_t channel, uint16_t fields);	// Note fields of a channel as changed, adding it to decodeChangedChannels if it wasn't already
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// One row of the register-to-field table
+typedef struct
+{
+	uint8_t firstRegister;	// Range of registers within a bank (0x00-0xFF)
+	uint8_t lastRegister;
+	uint8_t banks;			// DECODE_BANK_*
+	uint8_t target;			// DECODE_TARGET_*
+	uint8_t member;			// For operator/channel targets, offset of the member in oplOperator/oplChannel
+	uint8_t shift;			// Member = (register >> shift) & mask
+	uint8_t mask;
+	uint16_t field;			// DECODE_* bit to set when it changes (first operator's, for operators)
+} decodeField;
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern const decodeField decodeFields[];	// The register-to-field table, in register order
+extern uint16_t decodeChannelChanges[18];	// DECODE_* bits waiting to be drawn, for each channel
+extern uint8_t decodeChangedChannels[18];	// Channels with anything in decodeChannelChanges, in the order they changed
+extern uint8_t decodeChangedCount;			// How many of those there are
+extern uint8_t decodeGlobalChanges;			// DECODE_GLOBAL_* bits waiting to be drawn
+extern uint32_t decodeRegisterCount;		// How many changed registers have been decoded
+
+#endif
@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// FIFO.C - Pre-decoded OPL event queue for ISR write mode
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "fifo.h"
+#include "opl.h"
+#include "timer.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+oplEvent eventQueue[EVENT_QUEUE_SIZE];
+volatile uint8_t eventQueueHead = 0;
+volatile uint8_t eventQueueTail = 0;
+volatile uint8_t eventQueueActive = FALSE;
+uint8_t eventQueueEndOfData = FALSE;
+volatile uint16_t eventQueueBudgetOverruns = 0;
+volatile uint16_t eventQueueLockDeferrals = 0;
+uint16_t eventQueueFullStalls = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void resetEventQueue(void)
+{
+	// Only safe to call while the timer interrupt isn't draining the queue
+	eventQueueActive = FALSE;
+	eventQueueHead = 0;
+	eventQueueTail = 0;
+	eventQueueEndOfData = FALSE;
+}
+
+uint8_t pushEvent(uint32_t sample, uint16_t reg, uint8_t data)
+{
+	if (eventQueueFull())
+	{
+		eventQueueFullStalls++;
+		return 1;
+	}
+	// Fill in the slot completely BEFORE moving the head, otherwise the interrupt could grab a half-written event
+	eventQueue[eventQueueHead].sample = sample;
+	eventQueue[eventQueueHead].reg = reg;
+	eventQueue[eventQueueHead].data = data;
+	eventQueueHead++;
+	return 0;
+}
+
+void drainEventQueue(void)
+{
+	uint8_t budget = EVENT_QUEUE_ISR_BUDGET;
+
+	// If we interrupted the main loop halfway through its own OPL write (reset, panic button, etc) we can't touch the ports now.
+	// The index register is already pointing somewhere else!  Just try again next tick.
+	if (oplWriteLock != 0)
+	{
+		eventQueueLockDeferrals++;
+		return;
+	}
+
+	while (!eventQueueEmpty())
+	{
+		// Same rule as processCommands() - only send writes whose sample the timer has already passed
+		if (eventQueue[eventQueueTail].sample >= tickCounter)
+		{
+			return;
+		}
+		// Still have due writes but we've used up this tick's allowance
+		if (budget == 0)
+		{
+			eventQueueBudgetOverruns++;
+			return;
+		}
+		writeOPL(eventQueue[eventQueueTail].reg, eventQueue[eventQueueTail].data);
+		eventQueueTail++;
+		budget--;
+	}
+}
@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// FIFO.H - Pre-decoded OPL event queue for ISR write mode
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_FIFO_H
+#define VGMSLAP_FIFO_H
+
+#include "types.h"
+
+// The queue is 256 entries so that the 8-bit head/tail indexes wrap around on their own.
+// There is one producer (the main loop) and one consumer (the timer interrupt).  Only the producer moves the head and only the consumer moves the tail, so no locking is needed.
+#define EVENT_QUEUE_SIZE 256
+
+// Maximum number of OPL writes the timer interrupt is allowed to make in one tick.
+// Anything left over is picked up on the next tick, so a burst of writes can't hog the CPU for too long.
+#define EVENT_QUEUE_ISR_BUDGET 8
+
+// How far ahead of the timer (in 44100hz ticks) the main loop decodes commands into the queue.
+// Two screen refreshes' worth gives a slow drawChannelTable() pass plenty of slack.
+#define EVENT_QUEUE_LOOKAHEAD 2520
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// A single decoded OPL write and the sample it is due on
+typedef struct
+{
+	uint32_t sample;
+	uint16_t reg;
+	uint8_t data;
+} oplEvent;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void resetEventQueue(void);											// Empty the queue (statistics are kept for the whole session)
+uint8_t pushEvent(uint32_t sample, uint16_t reg, uint8_t data);	// Add a decoded write to the queue (returns 1 if it was full)
+void drainEventQueue(void);											// Called from the timer interrupt to send any writes that are due
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern oplEvent eventQueue[EVENT_QUEUE_SIZE];	// Ring buffer of pending writes
+extern volatile uint8_t eventQueueHead;			// Next free slot (only moved by the main loop)
+extern volatile uint8_t eventQueueTail;			// Next write to send (only moved by the timer interrupt)
+extern volatile uint8_t eventQueueActive;		// Set when the timer interrupt should drain the queue
+extern uint8_t eventQueueEndOfData;				// Set once the VGM has no more commands to decode
+
+// Statistics, shown on exit
+extern volatile uint16_t eventQueueBudgetOverruns;	// Ticks where writes were due but the per-tick budget ran out
+extern volatile uint16_t eventQueueLockDeferrals;	// Ticks skipped because the main loop was in the middle of its own OPL write
+extern uint16_t eventQueueFullStalls;				// Times the main loop had to stop decoding because the queue was full
+
+#define eventQueueEmpty() (eventQueueHead == eventQueueTail)
+#define eventQueueFull() ((uint8_t)(eventQueueHead + 1) == eventQueueTail)
+
+#endif
@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// GOLDEN.C - Regression check against known-good renders
+//
+// Renders a list of songs through the emulator and compares a CRC of the audio
+// and a CRC of every register write (and the sample it landed on) against
+// what they were last time.  That way a change to the VGM parser, the timing
+// or the emulator can be checked against a pile of songs without having to sit
+// and listen to all of them, and anything that got slower shows up too.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "golden.h"
+#include "opl.h"
+#include "render.h"
+#include "settings.h"
+#include "vgm.h"
+#include "vgmslap.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t goldenActive = FALSE;
+uint32_t goldenAudioCrc = 0;
+uint32_t goldenWriteCrc = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void goldenReadThreshold(char* fileName)
+{
+	FILE *thresholdFile;
+	char keyName[9];
+	char keyValueText[9];
+	uint16_t keyValueDecimal;
+	char lineBuffer[80];
+
+	// It's checked in next to the source, so a missing one means something's wrong rather than "use the default"
+	errno = 0;
+	thresholdFile = fopen(fileName, "rt");
+	if (thresholdFile == NULL)
+	{
+		killProgram(ERROR_GOLDEN_THRESHOLD_FAILED);
+	}
+	while (fgets(lineBuffer, sizeof(lineBuffer), thresholdFile) != NULL)
+	{
+		// Same as VGMSLAP.CFG: comments start with ;, everything else is KEY VALUE
+		if (lineBuffer[0] == ';')
+		{
+			continue;
+		}
+		if (sscanf(lineBuffer, "%8s %8s", keyName, keyValueText) != 2)
+		{
+			continue;
+		}
+		keyValueDecimal = (uint16_t)strtol(keyValueText, NULL, 10);
+		// How much slower (in percent) a song can render before it's called out
+		if (strcmp(keyName, "GOLDSLOW") == 0)
+		{
+			// Bounds check
+			if (keyValueDecimal > 255)
+			{
+				keyValueDecimal = 255;
+			}
+			settings.goldenSlow = keyValueDecimal;
+		}
+	}
+	fclose(thresholdFile);
+}
+
+uint8_t goldenRun(char* goldenFileName, uint8_t update)
+{
+	FILE *goldenFile;
+	goldenEntry *entries;
+	uint16_t entryCount = 0;
+	uint16_t entryMax = 0;
+	uint16_t i;
+	char lineBuffer[PATH_MAX + 40];
+	char nameBuffer[PATH_MAX];
+	char scanFormat[24];
+	int fields;
+	char settingsNow[80];
+	char settingsThen[80];
+	uint32_t audioCrc;
+	uint32_t writeCrc;
+	uint32_t renderTime;
+	clock_t startTime;
+	uint16_t failed = 0;
+	uint16_t slow = 0;
+	uint16_t added = 0;
+
+	// First time through just counts the lines, so there's room for all of them
+	errno = 0;
+	goldenFile = fopen(goldenFileName, "rt");
+	if (goldenFile == NULL)
+	{
+		killProgram(ERROR_GOLDEN_FILE_FAILED);
+	}
+	while (fgets(lineBuffer, sizeof(lineBuffer), goldenFile) != NULL)
+	{
+		entryMax++;
+	}
+	entries = (goldenEntry*)malloc(sizeof(goldenEntry) * (entryMax + 1));
+	if (entries == NULL)
+	{
+		killProgram(ERROR_RENDER_NO_MEMORY);
+	}
+
+	// Second time through reads them.  The name can't be allowed to run past the end of nameBuffer, so its %s gets a width.
+	sprintf(scanFormat, "%%%us %%lx %%lx %%lu", (uint16_t)(sizeof(nameBuffer) - 1));
+	goldenSettings(settingsNow);
+	settingsThen[0] = '\0';
+	rewind(goldenFile);
+	while (fgets(lineBuffer, sizeof(lineBuffer), goldenFile) != NULL)
+	{
+		// Comments are skipped, except for the one /UPDATE leaves saying what the settings were
+		if (lineBuffer[0] == ';')
+		{
+			if (strncmp(lineBuffer, "; Settings: ", 12) == 0)
+			{
+				strncpy(settingsThen, &lineBuffer[12], sizeof(settingsThen) - 1);
+				settingsThen[sizeof(settingsThen) - 1] = '\0';
+				settingsThen[strcspn(settingsThen, "\r\n")] = '\0';
+			}
+			continue;
+		}
+		// This has to be a plain int - sscanf gives back EOF (-1) for a blank line, which a uint16_t would turn into 65535
+		fields = sscanf(lineBuffer, scanFormat, nameBuffer, &audioCrc, &writeCrc, &renderTime);
+		// Blank lines (usually at the end of the file) aren't songs
+		if (fields < 1)
+		{
+			continue;
+		}
+		entries[entryCount].fileName = strdup(nameBuffer);
+		if (entries[entryCount].fileName == NULL)
+		{
+			killProgram(ERROR_RENDER_NO_MEMORY);
+		}
+		entries[entryCount].hasGolden = (fields == 4) ? TRUE : FALSE;
+		entries[entryCount].audioCrc = audioCrc;
+		entries[entryCount].writeCrc = writeCrc;
+		entries[entryCount].renderTime = (fields == 4) ? renderTime : 0;
+		entryCount++;
+	}
+	fclose(goldenFile);
+
+	// Anything that changes the audio will make every song fail, which isn't much use
+	if (settingsThen[0] != '\0' && strcmp(settingsThen, settingsNow) != 0)
+	{
+		printf("Warning: these goldens were made with different settings!\n");
+		printf("  Then: %s\n", settingsThen);
+		printf("  Now:  %s\n", settingsNow);
+	}
+
+	for (i = 0; i < entryCount; i++)
+	{
+		printf("\nSong %u of %u\n", i + 1, entryCount);
+		// Same as a CRC of nothing, so a song with no writes or no audio still comes out the same every time
+		goldenAudioCrc = crc32(0L, Z_NULL, 0);
+		goldenWriteCrc = crc32(0L, Z_NULL, 0);
+		goldenActive = TRUE;
+		startTime = clock();
+		renderVGM(entries[i].fileName, NULL);
+		entries[i].newTime = ((uint32_t)(clock() - startTime) * 1000) / CLOCKS_PER_SEC;
+		goldenActive = FALSE;
+		printf("Audio %.8lX, writes %.8lX, %lums\n", goldenAudioCrc, goldenWriteCrc, entries[i].newTime);
+
+		// Work out what happened, and keep it for the summary
+		entries[i].result = GOLDEN_RESULT_OK;
+		if (entries[i].hasGolden == FALSE)
+		{
+			entries[i].result = GOLDEN_RESULT_NEW;
+			added++;
+		}
+		else if (goldenAudioCrc != entries[i].audioCrc || goldenWriteCrc != entries[i].writeCrc)
+		{
+			entries[i].result = GOLDEN_RESULT_FAILED;
+			failed++;
+		}
+		else if (settings.goldenSlow > 0 && entries[i].renderTime >= GOLDEN_MIN_TIME &&
+			entries[i].newTime > entries[i].renderTime + (entries[i].renderTime / 100) * settings.goldenSlow)
+		{
+			entries[i].result = GOLDEN_RESULT_SLOW;
+			slow++;
+		}
+
+		// /UPDATE keeps whatever this render came up with
+		if (update == TRUE)
+		{
+			entries[i].audioCrc = goldenAudioCrc;
+			entries[i].writeCrc = goldenWriteCrc;
+			entries[i].hasGolden = TRUE;
+		}
+	}
+
+	// Job summary - one line per song, then the totals
+	printf("\n  #  Song                        Golden       Now  Result\n");
+	for (i = 0; i < entryCount; i++)
+	{
+		printf("%3u  %-24.24s %7lums %7lums  ", i + 1, entries[i].fileName, entries[i].renderTime, entries[i].newTime);
+		switch (entries[i].result)
+		{
+			case GOLDEN_RESULT_NEW:
+				printf("new\n");
+				break;
+			case GOLDEN_RESULT_FAILED:
+				printf("FAILED\n");
+				break;
+			case GOLDEN_RESULT_SLOW:
+				printf("SLOW (+%lu%%)\n", ((entries[i].newTime - entries[i].renderTime) * 100) / entries[i].renderTime);
+				break;
+			default:
+				printf("ok\n");
+				break;
+		}
+	}
+	printf("\n%u songs: %u failed, %u more than %u%% slower, %u new\n", entryCount, failed, slow, settings.goldenSlow, added);
+
+	// Write it all back out with the new values
+	if (update == TRUE)
+	{
+		errno = 0;
+		goldenFile = fopen(goldenFileName, "wt");
+		if (goldenFile == NULL)
+		{
+			killProgram(ERROR_GOLDEN_FILE_FAILED);
+		}
+		fprintf(goldenFile, "; VGMSlap golden renders - VGMSLAP /G %s to check\n", goldenFileName);
+		fprintf(goldenFile, "; Settings: %s\n", settingsNow);
+		for (i = 0; i < entryCount; i++)
+		{
+			fprintf(goldenFile, "%s %.8lX %.8lX %lu\n", entries[i].fileName, entries[i].audioCrc, entries[i].writeCrc, entries[i].newTime);
+		}
+		fclose(goldenFile);
+		printf("Goldens updated in %s\n", goldenFileName);
+	}
+
+	for (i = 0; i < entryCount; i++)
+	{
+		free(entries[i].fileName);
+	}
+	free(entries);
+	return (failed > 0 || slow > 0) ? TRUE : FALSE;
+}
+
+void goldenRecord(uint16_t reg, uint8_t data)
+{
+	uint8_t record[7];
+
+	// Byte by byte so the CRC comes out the same whatever order the machine keeps its bytes in
+	record[0] = (uint8_t)(dataCurrentSample & 0xFF);
+	record[1] = (uint8_t)((dataCurrentSample >> 8) & 0xFF);
+	record[2] = (uint8_t)((dataCurrentSample >> 16) & 0xFF);
+	record[3] = (uint8_t)((dataCurrentSample >> 24) & 0xFF);
+	record[4] = (uint8_t)(reg & 0xFF);
+	record[5] = (uint8_t)(reg >> 8);
+	record[6] = data;
+	goldenWriteCrc = crc32(goldenWriteCrc, record, sizeof(record));
+}
+
+void goldenAudio(int16_t *buffer, uint16_t frames)
+{
+	// Samples are little-endian, same as they go in the WAV
+	goldenAudioCrc = crc32(goldenAudioCrc, (uint8_t*)buffer, frames * 2 * sizeof(int16_t));
+}
+
+void goldenSettings(char* buffer)
+{
+	// Anything that changes the audio or the writes.  Rendering always picks an OPL3 if no emulator was set.
+	sprintf(buffer, "EMULATOR %u QUALITY %u SKIPIDLE %u RATE %u TAPS %u LOOPS %u",
+		settings.emulator == 0 ? DETECTED_OPL3 : settings.emulator, settings.quality, settings.skipIdle,
+		settings.outputRate, settings.resampleTaps, settings.loopCount);
+}
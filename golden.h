@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// GOLDEN.H - Regression check against known-good renders
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_GOLDEN_H
+#define VGMSLAP_GOLDEN_H
+
+#include "types.h"
+
+// Golden file layout (plain text, one song per line):
+//   <VGM file> <audio CRC-32> <register write CRC-32> <render time in ms>
+//   Lines starting with ; are comments.  A line with just the VGM file on it is a song that hasn't been rendered yet.
+// /UPDATE writes the whole file back out with fresh values, plus a comment saying which settings made them.
+
+// What happened to each song
+#define GOLDEN_RESULT_OK 0
+#define GOLDEN_RESULT_NEW 1		// No golden to compare against yet
+#define GOLDEN_RESULT_FAILED 2	// Audio or writes didn't match
+#define GOLDEN_RESULT_SLOW 3	// Matched, but took more than GOLDSLOW percent longer
+
+// Renders shorter than this are too quick for the DOS clock to time fairly, so they don't get a speed check
+#define GOLDEN_MIN_TIME 1000
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void goldenReadThreshold(char* fileName);		// Load the slowdown threshold from a threshold file (same layout as VGMSLAP.CFG)
+uint8_t goldenRun(char* goldenFileName, uint8_t update);	// Render every song in a golden file and compare (or update) - returns TRUE if anything failed
+void goldenRecord(uint16_t reg, uint8_t data);	// Called by writeOPL() while a golden render is going
+void goldenAudio(int16_t *buffer, uint16_t frames);	// Called with each block of finished audio while a golden render is going
+void goldenSettings(char* buffer);				// Describe the settings that change what a render comes out as
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint8_t goldenActive;		// Set while a golden render is going
+extern uint32_t goldenAudioCrc;		// Running CRC-32 of the audio
+extern uint32_t goldenWriteCrc;		// Running CRC-32 of the register writes and when they happened
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// One song from the golden file
+typedef struct
+{
+	char* fileName;
+	uint8_t hasGolden;		// FALSE until the song has been rendered with /UPDATE
+	uint32_t audioCrc;
+	uint32_t writeCrc;
+	uint32_t renderTime;	// In milliseconds
+	uint32_t newTime;		// How long it took this time
+	uint8_t result;			// GOLDEN_RESULT_*
+} goldenEntry;
+
+#endif
@@ -0,0 +1,247 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// MKTABLES.C - Builds OPLTAB.C, the emulator's lookup tables
+//
+// This used to happen every time VGMSlap started, which meant pulling in the
+// floating point library and a noticeable wait on an 8088 before anything
+// played - hurts most when rendering a big pile of files one at a time.  Now
+// the Makefile runs this once and the tables are just constant data in the
+// EXE.  It's not part of VGMSlap itself, so it has its own main().
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <stdio.h>
+
+#include "types.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint16_t mkLogSinTable[256];
+uint16_t mkExpTable[256];
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void mkBuildTables(void);									// Work out the log-sin and exponent tables
+uint16_t mkWaveformLog(uint8_t waveform, uint16_t phase);	// Log-domain level of a waveform at a phase, for oplEmuWaveTable
+void mkWriteTable(FILE *outFile, uint16_t *table, uint16_t count);	// Write out the values of one table, 16 to a line
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char *argv[])
+{
+	FILE *outFile;
+	uint16_t waveRow[1024];
+	uint16_t i;
+	uint8_t waveform;
+
+	if (argc != 2)
+	{
+		printf("Usage: MKTABLES <output file>\n");
+		return 1;
+	}
+	outFile = fopen(argv[1], "wt");
+	if (outFile == NULL)
+	{
+		printf("Couldn't open %s!\n", argv[1]);
+		return 1;
+	}
+	mkBuildTables();
+
+	fprintf(outFile, "///////////////////////////////////////////////////////////////////////////////\n");
+	fprintf(outFile, "//\n");
+	fprintf(outFile, "// OPLTAB.C - Emulator lookup tables\n");
+	fprintf(outFile, "//\n");
+	fprintf(outFile, "// Made by MKTABLES.EXE - change that and run it again instead of editing this.\n");
+	fprintf(outFile, "//\n");
+	fprintf(outFile, "///////////////////////////////////////////////////////////////////////////////\n\n");
+	fprintf(outFile, "#include \"oplemu.h\"\n\n");
+
+	fprintf(outFile, "const uint16_t oplEmuExpTable[256] = {\n");
+	mkWriteTable(outFile, mkExpTable, 256);
+	fprintf(outFile, "};\n\n");
+
+	// Every waveform at every phase, so the sample loop never has to work out which quarter of the wave it's in
+	fprintf(outFile, "const uint16_t far oplEmuWaveTable[8][1024] = {\n");
+	for (waveform = 0; waveform < 8; waveform++)
+	{
+		for (i = 0; i < 1024; i++)
+		{
+			waveRow[i] = mkWaveformLog(waveform, i);
+		}
+		fprintf(outFile, "{\n");
+		mkWriteTable(outFile, waveRow, 1024);
+		fprintf(outFile, "}%s\n", (waveform < 7) ? "," : "");
+	}
+	fprintf(outFile, "};\n");
+
+	fclose(outFile);
+	return 0;
+}
+
+void mkBuildTables(void)
+{
+	uint16_t i;
+
+	for (i = 0; i < 256; i++)
+	{
+		// Quarter sine wave, stored as attenuation in 1/256ths of a power of two
+		mkLogSinTable[i] = (uint16_t)floor(-log(sin((i + 0.5) * 3.14159265358979 / 512.0)) / log(2.0) * 256.0 + 0.5);
+		// And the way back: 2^(-x/256), scaled so the loudest is just under 2048
+		mkExpTable[i] = (uint16_t)floor(pow(2.0, (255 - i) / 256.0) * 1024.0 + 0.5);
+	}
+}
+
+uint16_t mkWaveformLog(uint8_t waveform, uint16_t phase)
+{
+	uint16_t out = 0;
+	uint16_t neg = 0;
+
+	phase &= 0x3FF;
+	switch (waveform)
+	{
+		// Sine
+		case 0:
+			if (phase & 0x200)
+			{
+				neg = 0x8000;
+			}
+			if (phase & 0x100)
+			{
+				out = mkLogSinTable[(phase & 0xFF) ^ 0xFF];
+			}
+			else
+			{
+				out = mkLogSinTable[phase & 0xFF];
+			}
+			break;
+		// Half sine
+		case 1:
+			if (phase & 0x200)
+			{
+				out = 0x1000;
+			}
+			else if (phase & 0x100)
+			{
+				out = mkLogSinTable[(phase & 0xFF) ^ 0xFF];
+			}
+			else
+			{
+				out = mkLogSinTable[phase & 0xFF];
+			}
+			break;
+		// Absolute sine
+		case 2:
+			if (phase & 0x100)
+			{
+				out = mkLogSinTable[(phase & 0xFF) ^ 0xFF];
+			}
+			else
+			{
+				out = mkLogSinTable[phase & 0xFF];
+			}
+			break;
+		// Pulse sine
+		case 3:
+			if (phase & 0x100)
+			{
+				out = 0x1000;
+			}
+			else
+			{
+				out = mkLogSinTable[phase & 0xFF];
+			}
+			break;
+		// Sine, even periods only (OPL3)
+		case 4:
+			if ((phase & 0x300) == 0x100)
+			{
+				neg = 0x8000;
+			}
+			if (phase & 0x200)
+			{
+				out = 0x1000;
+			}
+			else if (phase & 0x80)
+			{
+				out = mkLogSinTable[((phase ^ 0xFF) << 1) & 0xFF];
+			}
+			else
+			{
+				out = mkLogSinTable[(phase << 1) & 0xFF];
+			}
+			break;
+		// Absolute sine, even periods only (OPL3)
+		case 5:
+			if (phase & 0x200)
+			{
+				out = 0x1000;
+			}
+			else if (phase & 0x80)
+			{
+				out = mkLogSinTable[((phase ^ 0xFF) << 1) & 0xFF];
+			}
+			else
+			{
+				out = mkLogSinTable[(phase << 1) & 0xFF];
+			}
+			break;
+		// Square (OPL3)
+		case 6:
+			if (phase & 0x200)
+			{
+				neg = 0x8000;
+			}
+			out = 0;
+			break;
+		// Derived square (OPL3)
+		case 7:
+			if (phase & 0x200)
+			{
+				neg = 0x8000;
+				phase = (phase & 0x1FF) ^ 0x1FF;
+			}
+			out = phase << 3;
+			break;
+	}
+	// Top bit flags a negative half of the wave
+	return out | neg;
+}
+
+void mkWriteTable(FILE *outFile, uint16_t *table, uint16_t count)
+{
+	uint16_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		if ((i & 0x0F) == 0)
+		{
+			fprintf(outFile, "\t");
+		}
+		fprintf(outFile, "0x%.4X", table[i]);
+		if (i < count - 1)
+		{
+			fprintf(outFile, ",");
+		}
+		if ((i & 0x0F) == 0x0F || i == count - 1)
+		{
+			fprintf(outFile, "\n");
+		}
+	}
+}
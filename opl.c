@@ -17,9 +17,14 @@
 #include <stdio.h>
 #include <conio.h>
 #include <dos.h>
+#include <string.h>
 
+#include "bus.h"
+#include "golden.h"
 #include "settings.h"
 #include "opl.h"
+#include "stream.h"
+#include "trace.h"
 #include "ui.h"
 #include "vgmslap.h"
 
@@ -31,11 +36,28 @@ uint16_t oplBaseAddr;
 OplDetectedType detectedChip = DETECTED_NONE;
 uint8_t oplDelayReg = 6;
 uint8_t oplDelayData = 35;
-char oplRegisterMap[0x1FF];
-char oplChangeMap[0x1FF];
+char oplRegisterSpace[OPL_REGISTER_SPACE];
+char oplChangeSpace[OPL_REGISTER_SPACE];
+char *oplRegisterMap = oplRegisterSpace;
+char *oplChangeMap = oplChangeSpace;
+uint16_t far oplChangeQueue[OPL_CHANGE_QUEUE_SIZE];
+volatile uint16_t oplChangeHead = 0;
+volatile uint16_t oplChangeTail = 0;
+char oplTouchedMap[OPL_REGISTER_SPACE];
+uint8_t oplChipCount = 1;
+uint8_t oplDisplayChip = 0;
+uint8_t oplRegisterMapValid = FALSE;
+uint32_t oplResetWrites = 0;
+uint32_t oplResetSkipped = 0;
+uint16_t oplRestoreWrites = 0;
 uint8_t commandReg = 0;
 uint8_t commandData = 0;
 uint8_t maxChannels = 9;
+volatile uint8_t oplWriteLock = 0;
+OplOutputType oplOutput = OUTPUT_HARDWARE;
+oplEmuChip oplEmu[2];
+int16_t oplMixBuffer[OPL_MIX_FRAMES * 2];
+oplEmuChip *oplEmuReference = NULL;
 
 const uint16_t oplOperatorOrder[] = {
 	0x00, 0x03,    // Channel 1 (OPL2)
@@ -79,6 +101,20 @@ void detectOPL(void)
 	// Start with assuming nothing is detected
 	detectedChip = DETECTED_NONE;
 
+	// Using the emulator - nothing to detect, we get whatever chip was asked for
+	if (settings.emulator != 0)
+	{
+		initOPLEmulator((OplDetectedType)settings.emulator);
+		sleep(1);
+		return;
+	}
+
+	// Get the bus clock going before touching the ports
+	busInit();
+
+	// Tag these writes in the trace, so a replay can tell them apart from the music
+	traceSource = TRACE_SOURCE_DETECT;
+
 	// Detect OPL2
 
 	// Reset timer 1 and timer 2
@@ -86,7 +122,7 @@ void detectOPL(void)
 	// Reset IRQ
 	writeOPL(0x04, 0x80);
 	// Read status register
-	statusRegisterResult1 = inp(oplBaseAddr);
+	statusRegisterResult1 = busRead(0, oplBaseAddr);
 	// Set timer 1
 	writeOPL(0x02, 0xFF);
 	// Unmask and start timer 1
@@ -94,7 +130,7 @@ void detectOPL(void)
 	// Wait at least 80 usec (0.08ms) - a 2ms delay should be enough
 	delay(2);
 	// Read status register
-	statusRegisterResult2 = inp(oplBaseAddr);
+	statusRegisterResult2 = busRead(0, oplBaseAddr);
 	// Reset timer 1, timer 2, and IRQ again
 	writeOPL(0x04, 0x60);
 	writeOPL(0x04, 0x80);
@@ -115,11 +151,11 @@ void detectOPL(void)
 		{
 			writeOPL(0x104, 0x60);
 			writeOPL(0x104, 0x80);
-			statusRegisterResult1 = inp(oplBaseAddr+2);
+			statusRegisterResult1 = busRead(0, oplBaseAddr+2);
 			writeOPL(0x102, 0xFF);
 			writeOPL(0x104, 0x21);
 			delay(2);
-			statusRegisterResult2 = inp(oplBaseAddr+2);
+			statusRegisterResult2 = busRead(0, oplBaseAddr+2);
 			writeOPL(0x104, 0x60);
 			writeOPL(0x104, 0x80);
 			if ((statusRegisterResult1 & 0xE0) == 0x00 && (statusRegisterResult2 & 0xE0) == 0xC0)
@@ -128,7 +164,9 @@ void detectOPL(void)
 			}
 		}
 	}
+	traceSource = TRACE_SOURCE_PLAYER;
 	// Set delays, print results
+	// Delays are in PIT ticks (0.84us each).  The OPL2 needs 3.3us after an index write and 23us after a data write, and the OPL3 barely needs any, so these leave plenty of slack.
 	switch (detectedChip)
 	{
 		case DETECTED_NONE:
@@ -149,21 +187,107 @@ void detectOPL(void)
 			oplDelayData = 3;
 			printf("OPL3 detected at %Xh!\n", settings.oplBase);
 			break;
-
+		case DETECTED_DUAL_OPL3:
+		default:
+			// Nothing on the ISA bus gets detected as dual OPL3 (that's emulator only), so anything else here is a bug.
+			// Better to stop than to carry on with whatever delays were left over.
+			detectedChip = DETECTED_NONE;
+			killProgram(ERROR_OPL_DETECTION_FAILED);
+			break;
 	}
 	sleep(1);
 }
 
+void initOPLEmulator(OplDetectedType chip)
+{
+	uint8_t chipType = OPL_EMU_YMF262;
+
+	oplOutput = OUTPUT_EMULATOR;
+	detectedChip = chip;
+	// Fresh chips don't match whatever the register map has in it, so the next reset has to do everything
+	oplRegisterMapValid = FALSE;
+	if (detectedChip != DETECTED_OPL3 && detectedChip != DETECTED_DUAL_OPL3)
+	{
+		chipType = OPL_EMU_YM3812;
+	}
+	// Dual OPL3 needs room for a second chip's worth of registers
+	oplChipCount = 1;
+	if (detectedChip == DETECTED_DUAL_OPL3)
+	{
+		oplChipCount = 2;
+	}
+	selectOPLDisplayChip(0);
+	oplEmuReset(&oplEmu[0], chipType);
+	oplEmuReset(&oplEmu[1], chipType);
+	oplEmu[0].skipSilence = settings.skipIdle;
+	oplEmu[1].skipSilence = settings.skipIdle;
+	oplEmu[0].quality = settings.quality;
+	oplEmu[1].quality = settings.quality;
+	// The reference chips get every write too, but never take shortcuts (they're left at accurate quality)
+	if (oplEmuReference != NULL)
+	{
+		oplEmuReset(&oplEmuReference[0], chipType);
+		oplEmuReset(&oplEmuReference[1], chipType);
+	}
+	switch (detectedChip)
+	{
+		case DETECTED_OPL2:
+			printf("Emulated OPL2 ready!\n");
+			break;
+		case DETECTED_DUAL_OPL2:
+			// Like the Sound Blaster Pro 1.0 - one chip on the left, one on the right
+			printf("Emulated dual OPL2 ready!\n");
+			break;
+		case DETECTED_OPL3:
+			printf("Emulated OPL3 ready!\n");
+			break;
+		case DETECTED_DUAL_OPL3:
+			// No card like this exists, but there's nothing stopping the emulator from running two
+			printf("Emulated dual OPL3 ready!\n");
+			break;
+		case DETECTED_NONE:
+		default:
+			// Asking for no chip (or one we've never heard of) would leave the chip count and type above meaning nothing.
+			// Forget it before quitting, so killProgram doesn't try to reset it.
+			detectedChip = DETECTED_NONE;
+			killProgram(ERROR_OPL_DETECTION_FAILED);
+			break;
+	}
+}
+
 void resetOPL(void)
 {
 		// Resetting the OPL has to be somewhat systematic - otherwise you run into issues with static sounds, squeaking, etc, not only when cutting off the sound but also when the sound starts back up again.
+		// After the first reset, the register map knows what's in the chip, so writeOPLReset only sends registers that are different from where they're headed, and operators nobody has touched since the last reset get skipped outright.
 
+		uint16_t base;
+		uint8_t previousSource = traceSource;
+
+		traceSource = TRACE_SOURCE_RESET;
+
+		// Each OPL3-sized chip gets the same treatment
+		for (base = 0; base < oplChipCount * OPL_CHIP_REGISTERS; base += OPL_CHIP_REGISTERS)
+		{
+			resetOPLChip(base);
+		}
+
+		// The chip is now exactly what the register map says, and nothing has been touched since
+		memset(oplTouchedMap, 0, sizeof(oplTouchedMap));
+		oplRegisterMapValid = TRUE;
+		traceSource = previousSource;
+}
+
+void resetOPLChip(uint16_t base)
+{
 		uint16_t i;
+		// Does this chip have a second register set, and is it an OPL3?
+		uint8_t highBank = (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3 || detectedChip == DETECTED_DUAL_OPL3);
+		uint8_t opl3 = (detectedChip == DETECTED_OPL3 || detectedChip == DETECTED_DUAL_OPL3);
 
 		// For OPL3, turn on the NEW bit.  This ensures we can write to ALL registers on an OPL3.
-		if (detectedChip == DETECTED_OPL3)
+		if (opl3 == TRUE)
 		{
-			writeOPL(0x105,0x01);
+			writeOPLReset(base+0x105,0x01);
 		}
 
 		// Clear out the channel level information
@@ -171,18 +295,18 @@ void resetOPL(void)
 		// OPL2
 		for (i=0; i<9; i++)
 		{
-			writeOPL(0xA0+i, 0x00); // Frequency number (LSB)
-			writeOPL(0xB0+i, 0x00); // Key-On + Block + Frequency (MSB)
-			writeOPL(0xC0+i, 0x30); // Panning, Feedback, Synthesis Type
+			writeOPLReset(base+0xA0+i, 0x00); // Frequency number (LSB)
+			writeOPLReset(base+0xB0+i, 0x00); // Key-On + Block + Frequency (MSB)
+			writeOPLReset(base+0xC0+i, 0x30); // Panning, Feedback, Synthesis Type
 		}
 		// Dual OPL2 / OPL3
-		if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
+		if (highBank == TRUE)
 		{
 			for (i=0; i<9; i++)
 			{
-				writeOPL(0x1A0+i, 0x00); // Frequency number (LSB)
-				writeOPL(0x1B0+i, 0x00); // Key-On + Block + Frequency (MSB)
-				writeOPL(0x1C0+i, 0x30); // Panning, Feedback, Synthesis Type
+				writeOPLReset(base+0x1A0+i, 0x00); // Frequency number (LSB)
+				writeOPLReset(base+0x1B0+i, 0x00); // Key-On + Block + Frequency (MSB)
+				writeOPLReset(base+0x1C0+i, 0x30); // Panning, Feedback, Synthesis Type
 			}
 		}
 
@@ -194,30 +318,40 @@ void resetOPL(void)
 		// OPL2
 		for (i=0; i<18; i++)
 		{
-			writeOPL(0x20+oplOperatorOrder[i], 0x00); // Tremolo / Vibrato / Sustain / KSR / Multiplier
-			writeOPL(0x40+oplOperatorOrder[i], 0x3F); // Output attenuation is set to max
-			writeOPL(0x60+oplOperatorOrder[i], 0xFF); // Attack / Decay - Set to "max" to force note decay
-			writeOPL(0x80+oplOperatorOrder[i], 0xFF); // Sustain / Relase - Set to "max" to force note decay
-			writeOPL(0xE0+oplOperatorOrder[i], 0x00); // Waveform Select
+			if (oplOperatorDirty(base, i) == FALSE)
+			{
+				oplResetSkipped += 5;
+				continue;
+			}
+			writeOPLReset(base+0x20+oplOperatorOrder[i], 0x00); // Tremolo / Vibrato / Sustain / KSR / Multiplier
+			writeOPLReset(base+0x40+oplOperatorOrder[i], 0x3F); // Output attenuation is set to max
+			writeOPLReset(base+0x60+oplOperatorOrder[i], 0xFF); // Attack / Decay - Set to "max" to force note decay
+			writeOPLReset(base+0x80+oplOperatorOrder[i], 0xFF); // Sustain / Relase - Set to "max" to force note decay
+			writeOPLReset(base+0xE0+oplOperatorOrder[i], 0x00); // Waveform Select
 		}
 		// Dual OPL2 / OPL3
-		if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
+		if (highBank == TRUE)
 		{
 			for (i=18; i<36; i++)
 			{
-				writeOPL(0x20+oplOperatorOrder[i], 0x00); // Tremolo / Vibrato / Sustain / KSR / Multiplier
-				writeOPL(0x40+oplOperatorOrder[i], 0x3F); // Output attenuation is set to max
-				writeOPL(0x60+oplOperatorOrder[i], 0xFF); // Attack / Decay - Set to "max" to force note decay
-				writeOPL(0x80+oplOperatorOrder[i], 0xFF); // Sustain / Relase - Set to "max" to force note decay
-				writeOPL(0xE0+oplOperatorOrder[i], 0x00); // Waveform Select
+				if (oplOperatorDirty(base, i) == FALSE)
+				{
+					oplResetSkipped += 5;
+					continue;
+				}
+				writeOPLReset(base+0x20+oplOperatorOrder[i], 0x00); // Tremolo / Vibrato / Sustain / KSR / Multiplier
+				writeOPLReset(base+0x40+oplOperatorOrder[i], 0x3F); // Output attenuation is set to max
+				writeOPLReset(base+0x60+oplOperatorOrder[i], 0xFF); // Attack / Decay - Set to "max" to force note decay
+				writeOPLReset(base+0x80+oplOperatorOrder[i], 0xFF); // Sustain / Relase - Set to "max" to force note decay
+				writeOPLReset(base+0xE0+oplOperatorOrder[i], 0x00); // Waveform Select
 			}
 		}
 
 		// Clear out percussion mode register
-		writeOPL(0xBD,0x00);
-		if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
+		writeOPLReset(base+0xBD,0x00);
+		if (highBank == TRUE)
 		{
-			writeOPL(0x1BD,0x00);
+			writeOPLReset(base+0x1BD,0x00);
 		}
 
 		// Return to the ADSR and set them to zero - we set them to F earlier to force a note decay
@@ -225,18 +359,28 @@ void resetOPL(void)
 		// OPL2
 		for (i=0; i<18; i++)
 		{
-			writeOPL(0x60+oplOperatorOrder[i], 0x00); // Attack / Decay
-			writeOPL(0x80+oplOperatorOrder[i], 0x00); // Sustain / Release
-			writeOPL(0x40+oplOperatorOrder[i], 0x00); // Key Scale / Output Level
+			if (oplOperatorDirty(base, i) == FALSE)
+			{
+				oplResetSkipped += 3;
+				continue;
+			}
+			writeOPLReset(base+0x60+oplOperatorOrder[i], 0x00); // Attack / Decay
+			writeOPLReset(base+0x80+oplOperatorOrder[i], 0x00); // Sustain / Release
+			writeOPLReset(base+0x40+oplOperatorOrder[i], 0x00); // Key Scale / Output Level
 		}
 		// Dual OPL2 / OPL3
-		if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
+		if (highBank == TRUE)
 		{
 			for (i=18; i<36; i++)
 			{
-				writeOPL(0x60+oplOperatorOrder[i], 0x00); // Attack / Decay
-				writeOPL(0x80+oplOperatorOrder[i], 0x00); // Sustain / Release
-				writeOPL(0x40+oplOperatorOrder[i], 0x00); // Key Scale / Output Level
+				if (oplOperatorDirty(base, i) == FALSE)
+				{
+					oplResetSkipped += 3;
+					continue;
+				}
+				writeOPLReset(base+0x60+oplOperatorOrder[i], 0x00); // Attack / Decay
+				writeOPLReset(base+0x80+oplOperatorOrder[i], 0x00); // Sustain / Release
+				writeOPLReset(base+0x40+oplOperatorOrder[i], 0x00); // Key Scale / Output Level
 			}
 		}
 
@@ -244,7 +388,7 @@ void resetOPL(void)
 		// OPL2 regs
 		for (i = 0x00; i < 0x20; i++)
 		{
-			writeOPL(i,0x00);
+			writeOPLReset(base+i,0x00);
 		}
 
 		// If Dual OPL2 just clear it like an OPL2
@@ -252,81 +396,456 @@ void resetOPL(void)
 		{
 			for (i = 0x100; i < 0x120; i++)
 			{
-				writeOPL(i,0x00);
+				writeOPLReset(base+i,0x00);
 			}
 		}
 
 		// If OPL3, change plans...
-		if (detectedChip == DETECTED_OPL3)
+		if (opl3 == TRUE)
 		{
 			// OPL3 regs - works a bit differently.  We don't turn off 4-op mode until we have zeroed everything else out, and we must touch 0x105 (OPL3 enable / "NEW" bit) ABSOLUTELY LAST or our writes to OPL3 features will be completely ignored!  (Yes, that includes zeroing them out!!)
 			for (i = 0x100; i <= 0x103; i++)
 			{
-				writeOPL(i,0x00);
+				writeOPLReset(base+i,0x00);
 			}
 			for (i = 0x106; i < 0x120; i++)
 			{
-				writeOPL(i,0x00);
+				writeOPLReset(base+i,0x00);
 			}
 			// For OPL3, turn off 4-Op mode (if it was on)
-			writeOPL(0x104,0x00);
+			writeOPLReset(base+0x104,0x00);
 			// For OPL3, write the NEW bit back to 0.  We're now back in OPL2 mode.
 			// VGMs should have their own write to this bit to re-enable it for OPL3 songs.
-			writeOPL(0x105,0x00);
+			writeOPLReset(base+0x105,0x00);
 		}
 }
 
-void writeOPL(uint16_t reg, uint8_t data)
+void writeOPLReset(uint16_t reg, uint8_t data)
 {
-		// Setup delay count
-		uint8_t registerDelay = oplDelayReg;
-		uint8_t dataDelay = oplDelayData;
-		
-		// Second OPL2 and/or OPL3 secondary register set
-		if (reg >= 0x100)
-		{
-			// First write to target register... 
-			outp(oplBaseAddr+2, (reg - 0x100));
-			// Index register write delay.
-			// The OPL2 requires a minimum time between writes.  We can execute inp a certain number of times to ensure enough time has passed - why does that work?  Because the time it takes to complete an inp is based on the ISA bus timings!
-			while (registerDelay--)
+	// Once a reset has been done, the register map knows exactly what's in the chip, so there's no point sending what's already there.
+	// With OPL2 delays every write counts, and most songs only use a fraction of the registers.
+	if (oplRegisterMapValid == TRUE && oplRegisterSpace[reg] == data)
+	{
+		oplResetSkipped++;
+		return;
+	}
+	writeOPL(reg, data);
+	oplResetWrites++;
+}
+
+uint8_t oplOperatorDirty(uint16_t base, uint8_t op)
+{
+	uint16_t offset = base + oplOperatorOrder[op];
+	uint16_t bank = offset & 0x300;
+	uint8_t channel = (op % 18) / 2;
+
+	// If we don't know what's in the chip yet, everything gets the full treatment
+	if (oplRegisterMapValid == FALSE)
+	{
+		return TRUE;
+	}
+	// Any of the operator's own registers changed?
+	if (oplTouchedMap[0x20+offset] || oplTouchedMap[0x40+offset] || oplTouchedMap[0x60+offset] || oplTouchedMap[0x80+offset] || oplTouchedMap[0xE0+offset])
+	{
+		return TRUE;
+	}
+	// Even with its registers back at the reset values, an operator can still be sounding if its channel was keyed on.
+	// That's what the force-decay passes are for, so anything that could have started its envelope makes it dirty.
+	if (oplTouchedMap[bank+0xB0+channel])
+	{
+		return TRUE;
+	}
+	// Rhythm mode drums key on through 0xBD
+	if (channel >= 6 && oplTouchedMap[bank+0xBD])
+	{
+		return TRUE;
+	}
+	// In 4-op mode, the second half of a pair is keyed on by the first channel
+	if (channel >= 3 && channel <= 5 && oplTouchedMap[base+0x104] && oplTouchedMap[bank+0xB0+channel-3])
+	{
+		return TRUE;
+	}
+	return FALSE;
+}
+
+void snapshotOPL(oplSnapshot *snapshot)
+{
+	memcpy(snapshot->registers, oplRegisterSpace, sizeof(snapshot->registers));
+	memcpy(&snapshot->status, &oplStatus, sizeof(oplChip));
+}
+
+uint16_t restoreOPL(oplSnapshot *snapshot)
+{
+	uint16_t writes = 0;
+	uint16_t bank;
+	uint16_t banks = 0x100;
+	uint16_t base;
+	uint16_t i;
+	uint8_t opl3 = (detectedChip == DETECTED_OPL3 || detectedChip == DETECTED_DUAL_OPL3);
+
+	// Dual OPL2 and OPL3 have a second set of registers to put back, and dual OPL3 has two of those
+	if (detectedChip == DETECTED_DUAL_OPL2 || opl3 == TRUE)
+	{
+		banks = 0x200;
+	}
+	banks *= oplChipCount;
+
+	// Same idea as resetOPL, but backwards - set up the voices first, bring the levels up, and only then key the notes on.
+	// Anything the chip already has (according to the register map) gets skipped, so resuming from a pause is usually just the output levels.
+
+	// The OPL3 has to be in OPL3 mode before its second register set takes any writes, so if the snapshot has it on, that goes first...
+	for (base = 0; base < banks && opl3 == TRUE; base += OPL_CHIP_REGISTERS)
+	{
+		if (snapshot->registers[base+0x105] != 0)
+		{
+			writes += restoreOPLRegister(snapshot, base+0x105);
+		}
+		// ...and 4-op mode before any of the channels it pairs up
+		writes += restoreOPLRegister(snapshot, base+0x104);
+	}
+
+	for (bank = 0; bank < banks; bank += 0x100)
+	{
+		// Test, timer and CSM/keyboard split registers
+		for (i = 0x01; i < 0x20; i++)
+		{
+			// 0x104 and 0x105 on the OPL3 are taken care of separately
+			if (opl3 == TRUE && (bank & 0x100) != 0 && (i == 0x04 || i == 0x05))
 			{
-				inp(0x80);
+				continue;
 			}
-			
-			// ...then go to +1 for the data
-			outp(oplBaseAddr+3, data);
-			// Data register write delay.
-			while (dataDelay--)
+			writes += restoreOPLRegister(snapshot, bank + i);
+		}
+		// Operator settings, except for the output level
+		for (i = 0; i < 18; i++)
+		{
+			writes += restoreOPLRegister(snapshot, bank + 0x20 + oplOperatorOrder[i]);
+			writes += restoreOPLRegister(snapshot, bank + 0x60 + oplOperatorOrder[i]);
+			writes += restoreOPLRegister(snapshot, bank + 0x80 + oplOperatorOrder[i]);
+			writes += restoreOPLRegister(snapshot, bank + 0xE0 + oplOperatorOrder[i]);
+		}
+		// Channel frequencies and connections
+		for (i = 0; i < 9; i++)
+		{
+			writes += restoreOPLRegister(snapshot, bank + 0xA0 + i);
+			writes += restoreOPLRegister(snapshot, bank + 0xC0 + i);
+		}
+		// Output levels, now that the voices are ready
+		for (i = 0; i < 18; i++)
+		{
+			writes += restoreOPLRegister(snapshot, bank + 0x40 + oplOperatorOrder[i]);
+		}
+	}
+	// Key-ons last of all, and the rhythm mode drums after the regular channels
+	for (bank = 0; bank < banks; bank += 0x100)
+	{
+		for (i = 0; i < 9; i++)
+		{
+			writes += restoreOPLRegister(snapshot, bank + 0xB0 + i);
+		}
+		writes += restoreOPLRegister(snapshot, bank + 0xBD);
+	}
+	// If the snapshot was in OPL2 mode, the NEW bit can only come off once everything else is in
+	for (base = 0; base < banks && opl3 == TRUE; base += OPL_CHIP_REGISTERS)
+	{
+		if (snapshot->registers[base+0x105] == 0)
+		{
+			writes += restoreOPLRegister(snapshot, base+0x105);
+		}
+	}
+
+	// The registers now match, so the decoded version does too
+	memcpy(&oplStatus, &snapshot->status, sizeof(oplChip));
+	oplRestoreWrites = writes;
+	return writes;
+}
+
+uint8_t restoreOPLRegister(oplSnapshot *snapshot, uint16_t reg)
+{
+	// Until a reset has been done, we can't be sure what's in the chip, so everything gets written
+	if (oplRegisterMapValid == TRUE && oplRegisterSpace[reg] == snapshot->registers[reg])
+	{
+		return 0;
+	}
+	writeOPL(reg, snapshot->registers[reg]);
+	return 1;
+}
+
+uint16_t muteOPL(void)
+{
+	uint16_t writes = 0;
+	uint16_t base;
+	uint16_t reg;
+	uint8_t i;
+	uint8_t operators = 18;
+
+	if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3 || detectedChip == DETECTED_DUAL_OPL3)
+	{
+		operators = 36;
+	}
+	// Max attenuation on every operator first, keeping the key scale level bits, so everything drops at once...
+	for (base = 0; base < oplChipCount * OPL_CHIP_REGISTERS; base += OPL_CHIP_REGISTERS)
+	{
+		for (i = 0; i < operators; i++)
+		{
+			reg = base + 0x40 + oplOperatorOrder[i];
+			if ((oplRegisterSpace[reg] & 0x3F) != 0x3F)
 			{
-				inp(0x80);
+				writeOPL(reg, oplRegisterSpace[reg] | 0x3F);
+				writes++;
 			}
 		}
-		// OPL2 and/or OPL3 primary register set
-		else
+	}
+	// ...but that's only about -47dB, and a held note (or anything with feedback) is still plainly there on a real card.
+	// So key everything off as well and let the envelopes release to nothing.  restoreOPL keys the notes back on last, once the levels are back.
+	for (base = 0; base < oplChipCount * OPL_CHIP_REGISTERS; base += OPL_CHIP_REGISTERS)
+	{
+		for (reg = base; reg < base + (operators / 18) * 0x100; reg += 0x100)
 		{
-			// First write to target register... 
-			outp(oplBaseAddr, reg);
-			// Index register write delay.
-			// The OPL2 requires a minimum time between writes.  We can execute inp a certain number of times to ensure enough time has passed - why does that work?  Because the time it takes to complete an inp is based on the ISA bus timings!
-			while (registerDelay--)
+			for (i = 0; i < 9; i++)
 			{
-				inp(0x80);
+				if (oplRegisterSpace[reg + 0xB0 + i] & 0x20)
+				{
+					writeOPL(reg + 0xB0 + i, oplRegisterSpace[reg + 0xB0 + i] & 0xDF);
+					writes++;
+				}
 			}
-			
-			// ...then go to Base+1 for the data
-			outp(oplBaseAddr+1, data);
-			// Data register write delay.
-			while (dataDelay--)
+			// The rhythm mode drums have their own key-ons in 0xBD.  Rhythm mode itself (bit 5) stays on, so the channels don't change what they are.
+			if (oplRegisterSpace[reg + 0xBD] & 0x1F)
 			{
-				inp(0x80);
+				writeOPL(reg + 0xBD, oplRegisterSpace[reg + 0xBD] & 0xE0);
+				writes++;
 			}
 		}
+	}
+	return writes;
+}
+
+void writeOPL(uint16_t reg, uint8_t data)
+{
+		// Let the timer interrupt know the ports are busy (only matters in ISR write mode)
+		oplWriteLock = 1;
 		
-		// Write the same data to our "register map", used for visualizing the OPL state, as well as the change map to denote that this bit needs to be interpreted and potentially drawn.
-		oplRegisterMap[reg] = data;
-		oplChangeMap[reg] = 1;
+		// Software emulator - no ports and no delays needed
+		if (oplOutput == OUTPUT_EMULATOR)
+		{
+			// While streaming, the write waits in a queue until the synthesizer gets to its sample
+			if (streamActive == TRUE)
+			{
+				streamPushWrite(reg, data);
+			}
+			else
+			{
+				writeOPLEmulator(reg, data);
+			}
+		}
+		// Real chip - the second OPL2 and/or OPL3 secondary register set lives at Base+2, the rest at Base
+		else
+		{
+			// Only a second OPL2 is a chip of its own.  The OPL3's two register sets share one chip, so they share one gap.
+			uint8_t chip = (reg >= 0x100 && detectedChip == DETECTED_DUAL_OPL2) ? 1 : 0;
+			uint16_t port = (reg >= 0x100) ? oplBaseAddr + 2 : oplBaseAddr;
+
+			// First write to target register...
+			// The OPL2 requires a minimum time between writes.  busWrite keeps track of when the chip will be ready again, and only waits for whatever's left of that time at the next access.
+			busWrite(chip, port, (uint8_t)reg, oplDelayReg);
+			// ...then go to +1 for the data
+			busWrite(chip, port + 1, data, oplDelayData);
+		}
+		
+		// Keep a copy of every write if a trace is being recorded
+		if (traceRecording == TRUE)
+		{
+			traceRecord(reg, data);
+		}
+		// Or just a CRC of it, for a golden check
+		if (goldenActive == TRUE)
+		{
+			goldenRecord(reg, data);
+		}
+
+		// Note it as touched, so the next resetOPL knows to clean it up
+		oplTouchedMap[reg] = 1;
+
+		// Write the same data to our "register map", used for visualizing the OPL state, and queue it up to be interpreted and potentially drawn if it's on the chip being shown.
+		oplRegisterSpace[reg] = data;
+		if ((reg / OPL_CHIP_REGISTERS) == oplDisplayChip && oplChangeMap[reg % OPL_CHIP_REGISTERS] == 0)
+		{
+			markOPLChanged(reg % OPL_CHIP_REGISTERS);
+		}
 		
 		// Request a screen draw for the display update
 		requestScreenDraw = 1;
+
+		oplWriteLock = 0;
+}
+
+void writeOPLEmulator(uint16_t reg, uint8_t data)
+{
+	// Dual OPL3 - each chip has a whole 0x200 of registers
+	if (detectedChip == DETECTED_DUAL_OPL3 && reg >= OPL_CHIP_REGISTERS)
+	{
+		oplEmuWrite(&oplEmu[1], reg - OPL_CHIP_REGISTERS, data);
+		if (oplEmuReference != NULL)
+		{
+			oplEmuWrite(&oplEmuReference[1], reg - OPL_CHIP_REGISTERS, data);
+		}
+	}
+	// Dual OPL2 is two separate chips, so the "OPL3" bank goes to the second one
+	else if (detectedChip == DETECTED_DUAL_OPL2 && reg >= 0x100)
+	{
+		oplEmuWrite(&oplEmu[1], reg - 0x100, data);
+		if (oplEmuReference != NULL)
+		{
+			oplEmuWrite(&oplEmuReference[1], reg - 0x100, data);
+		}
+	}
+	else
+	{
+		oplEmuWrite(&oplEmu[0], reg, data);
+		if (oplEmuReference != NULL)
+		{
+			oplEmuWrite(&oplEmuReference[0], reg, data);
+		}
+	}
+}
+
+void generateOPL(int16_t *left, int16_t *right)
+{
+	int16_t unused;
+	int16_t secondLeft;
+	int16_t secondRight;
+
+	switch (oplOutput)
+	{
+		case OUTPUT_HARDWARE:
+			*left = 0;
+			*right = 0;
+			break;
+		case OUTPUT_EMULATOR:
+			if (detectedChip == DETECTED_DUAL_OPL2)
+			{
+				// OPL2s are mono, so each chip just gets one side
+				oplEmuGenerate(&oplEmu[0], left, &unused);
+				oplEmuGenerate(&oplEmu[1], right, &unused);
+			}
+			else if (detectedChip == DETECTED_DUAL_OPL3)
+			{
+				// Two stereo chips, mixed together
+				oplEmuGenerate(&oplEmu[0], left, right);
+				oplEmuGenerate(&oplEmu[1], &secondLeft, &secondRight);
+				*left = oplMixSamples(*left, secondLeft);
+				*right = oplMixSamples(*right, secondRight);
+			}
+			else
+			{
+				oplEmuGenerate(&oplEmu[0], left, right);
+			}
+			break;
+	}
+}
+
+void generateOPLBlock(int16_t *buffer, uint16_t frames)
+{
+	switch (oplOutput)
+	{
+		case OUTPUT_HARDWARE:
+			memset(buffer, 0, frames * sizeof(int16_t) * 2);
+			break;
+		case OUTPUT_EMULATOR:
+			generateEmulatorBlock(oplEmu, buffer, frames);
+			break;
+	}
+}
+
+void generateEmulatorBlock(oplEmuChip *chips, int16_t *buffer, uint16_t frames)
+{
+	uint16_t chunk;
+	uint16_t i;
+
+	if (detectedChip == DETECTED_DUAL_OPL2)
+	{
+		// The chips don't affect each other, so each one can do its whole side in one go
+		oplEmuGenerateBlock(&chips[0], buffer, NULL, frames);
+		oplEmuGenerateBlock(&chips[1], buffer + 1, NULL, frames);
+	}
+	else if (detectedChip == DETECTED_DUAL_OPL3)
+	{
+		// Each chip runs its whole block on its own (one after the other - DOS has no threads to spread them over), then the second is mixed into the first
+		oplEmuGenerateBlock(&chips[0], buffer, buffer + 1, frames);
+		while (frames > 0)
+		{
+			chunk = frames;
+			if (chunk > OPL_MIX_FRAMES)
+			{
+				chunk = OPL_MIX_FRAMES;
+			}
+			oplEmuGenerateBlock(&chips[1], oplMixBuffer, oplMixBuffer + 1, chunk);
+			for (i = 0; i < chunk * 2; i++)
+			{
+				buffer[i] = oplMixSamples(buffer[i], oplMixBuffer[i]);
+			}
+			buffer += chunk * 2;
+			frames -= chunk;
+		}
+	}
+	else
+	{
+		oplEmuGenerateBlock(&chips[0], buffer, buffer + 1, frames);
+	}
+}
+
+int16_t oplMixSamples(int16_t a, int16_t b)
+{
+	int32_t mixed = (int32_t)a + b;
+
+	// Clip instead of wrapping around
+	if (mixed > 32767)
+	{
+		return 32767;
+	}
+	if (mixed < -32768)
+	{
+		return -32768;
+	}
+	return (int16_t)mixed;
+}
+
+void selectOPLDisplayChip(uint8_t chip)
+{
+	uint16_t offset;
+	uint8_t previousLock = oplWriteLock;
+
+	// Nothing goes in the queue from the timer interrupt while it's being rebuilt
+	oplWriteLock = 1;
+	// The display only ever looks at one chip's worth of registers, through these two pointers
+	oplDisplayChip = chip;
+	oplRegisterMap = oplRegisterSpace + (chip * OPL_CHIP_REGISTERS);
+	oplChangeMap = oplChangeSpace + (chip * OPL_CHIP_REGISTERS);
+	// Have everything on the newly shown chip interpreted and drawn.  Start the queue over rather than leave the old chip's registers in it.
+	oplChangeHead = 0;
+	oplChangeTail = 0;
+	memset(oplChangeMap, 0, OPL_CHIP_REGISTERS);
+	for (offset = 0; offset < OPL_CHIP_REGISTERS; offset++)
+	{
+		markOPLChanged(offset);
+	}
+	requestScreenDraw = 1;
+	oplWriteLock = previousLock;
+}
+
+void markOPLChanged(uint16_t offset)
+{
+	// The timer interrupt can call writeOPL (and so this) in ISR write mode.  Holding the write lock keeps it
+	// from adding to the queue halfway through us doing the same.  writeOPL already holds it when it calls in.
+	uint8_t previousLock = oplWriteLock;
+
+	oplWriteLock = 1;
+	if (oplChangeMap[offset] == 0)
+	{
+		oplChangeMap[offset] = 1;
+		oplChangeQueue[oplChangeTail] = offset;
+		oplChangeTail = (oplChangeTail + 1) & (OPL_CHANGE_QUEUE_SIZE - 1);
+	}
+	oplWriteLock = previousLock;
 }
@@ -17,16 +17,49 @@
 #ifndef VGMSLAP_OPL_H
 #define VGMSLAP_OPL_H
 
+#include "oplemu.h"
 #include "types.h"
 
+// One OPL3's worth of registers (both banks).  Registers 0x200 and up belong to the second OPL3 when there is one.
+#define OPL_CHIP_REGISTERS 0x200
+
+// How many chips the register space has room for
+#define OPL_MAX_CHIPS 2
+#define OPL_REGISTER_SPACE (OPL_CHIP_REGISTERS * OPL_MAX_CHIPS)
+
+// Stereo samples the second of two OPL3s makes at a time before being mixed into the first
+#define OPL_MIX_FRAMES 128
+
+// Changed registers waiting for the channel table.  Each register only goes in once until it's been drawn,
+// and there's room for every one of them twice over, so the queue can never fill up and look empty.
+#define OPL_CHANGE_QUEUE_SIZE 0x400
+
+// Defined down with the other structs, but the snapshot functions need to know it exists
+typedef struct oplSnapshot oplSnapshot;
+
 ///////////////////////////////////////////////////////////////////////////////
 // Function declarations
 ///////////////////////////////////////////////////////////////////////////////
 
 void detectOPL(void);						// Detect what OPL chip is in the computer.
 											// (This determines what VGMs can be played.)
+void initOPLEmulator(OplDetectedType chip);	// Switch writeOPL over to the software emulator, pretending to be the given chip
 void resetOPL(void);						// Reset OPL to original state, including turning off OPL3 mode
+void resetOPLChip(uint16_t base);			// resetOPL for one chip, whose registers start at base
 void writeOPL(uint16_t reg, uint8_t data);	// Sends data to OPL chip, register then data
+void writeOPLReset(uint16_t reg, uint8_t data);	// Used by resetOPL - skips the write if the register map says the chip already has it
+uint8_t oplOperatorDirty(uint16_t base, uint8_t op);	// Could this operator (0-35, in oplOperatorOrder, on the chip at base) be anything but silent and at its reset values?
+void snapshotOPL(oplSnapshot *snapshot);	// Capture the whole chip state (registers and decoded status)
+uint16_t restoreOPL(oplSnapshot *snapshot);	// Put the chip back to a snapshot with as few writes as possible, in a click-free order.  Returns how many writes it took.
+uint8_t restoreOPLRegister(oplSnapshot *snapshot, uint16_t reg);	// Used by restoreOPL - write one register from the snapshot if the chip doesn't already have it.  Returns 1 if it wrote.
+uint16_t muteOPL(void);						// Turn every operator's output down and key off every note and drum, leaving everything else alone.  Returns how many writes it took.
+void writeOPLEmulator(uint16_t reg, uint8_t data);	// Sends a write straight to the emulated chip(s)
+void generateOPL(int16_t *left, int16_t *right);	// Get one sample of output from the emulator (silence for a real chip - that comes out of the card)
+void generateOPLBlock(int16_t *buffer, uint16_t frames);	// Same as generateOPL, but a run of samples into an interleaved stereo buffer
+void generateEmulatorBlock(oplEmuChip *chips, int16_t *buffer, uint16_t frames);	// generateOPLBlock for a particular pair of emulated chips
+int16_t oplMixSamples(int16_t a, int16_t b);	// Add two chips' samples together, clipping instead of wrapping
+void selectOPLDisplayChip(uint8_t chip);	// Point oplRegisterMap/oplChangeMap at one chip's registers for the display, and have it all redrawn
+void markOPLChanged(uint16_t offset);		// Queue one of the displayed chip's registers for drawChannelTable (unless it's already waiting)
 
 ///////////////////////////////////////////////////////////////////////////////
 // Variable declarations
@@ -34,13 +67,30 @@ void writeOPL(uint16_t reg, uint8_t data);	// Sends data to OPL chip, register t
 
 extern uint16_t oplBaseAddr;			// Base port for OPL synth.
 extern OplDetectedType detectedChip;	// What OPL chip we detect on the system from detectOPL (see types.h)
-extern uint8_t oplDelayReg;				// Delay required for OPL register write (set for OPL2 by default)
-extern uint8_t oplDelayData;			// Delay required for OPL data write (set for OPL2 by default)
-extern char oplRegisterMap[0x1FF];		// Stores current state of OPL registers
-extern char oplChangeMap[0x1FF];		// Written alongside oplRegisterMap, tracks bytes that need interpreted/drawn
+extern uint8_t oplDelayReg;				// PIT ticks required after an OPL register write (set for OPL2 by default)
+extern uint8_t oplDelayData;			// PIT ticks required after an OPL data write (set for OPL2 by default)
+extern char oplRegisterSpace[OPL_REGISTER_SPACE];	// Stores current state of OPL registers, every chip
+extern char oplChangeSpace[OPL_REGISTER_SPACE];		// Written alongside oplRegisterSpace, tracks bytes that need interpreted/drawn
+extern char *oplRegisterMap;			// The 0x200 registers of the chip on display (see selectOPLDisplayChip)
+extern char *oplChangeMap;				// ...and which of them need interpreted/drawn
+extern uint16_t far oplChangeQueue[OPL_CHANGE_QUEUE_SIZE];	// The flagged registers in the order they changed, so the drawer doesn't have to look through all of them
+extern volatile uint16_t oplChangeHead;	// Next register for the drawer to take
+extern volatile uint16_t oplChangeTail;	// Where the next changed register goes
+extern char oplTouchedMap[OPL_REGISTER_SPACE];	// Also written alongside oplRegisterSpace, tracks bytes written since the last resetOPL
+extern uint8_t oplChipCount;			// How many OPL3-sized register spaces are in use (2 for dual OPL3, otherwise 1)
+extern uint8_t oplDisplayChip;			// Which of them is on screen
+extern uint8_t oplRegisterMapValid;		// Set once a full reset has made the register map match the chip
+extern uint32_t oplResetWrites;			// Writes resetOPL actually sent
+extern uint32_t oplResetSkipped;		// Writes resetOPL skipped because the chip already had them
+extern uint16_t oplRestoreWrites;		// Writes the last restoreOPL took
 extern uint8_t commandReg;				// Stores current OPL register to manipulate
 extern uint8_t commandData;				// Stores current data to put in OPL register
 extern uint8_t maxChannels;				// When iterating channels, how many to go through (9 for OPL2, 18 for OPL3)
+extern volatile uint8_t oplWriteLock;	// Set while writeOPL is talking to the ports, so the timer interrupt knows not to butt in
+extern OplOutputType oplOutput;			// Where writeOPL sends its data (see types.h)
+extern oplEmuChip oplEmu[2];			// Emulated chips (the second one is only used for dual OPL2)
+extern int16_t oplMixBuffer[OPL_MIX_FRAMES * 2];	// Where the second OPL3 goes before being mixed in
+extern oplEmuChip *oplEmuReference;		// Two more chips that shadow oplEmu with no shortcuts, when checking the fast paths (otherwise NULL)
 
 // Due to weird operator offsets to form a channel, this is a list of offsets from the base (0x20/0x40/0x60/0x80/0xE0) for each.  First half is OPL2 and second is OPL3, so OPL3 ones have 0x100 added to fit our data model.
 // On the chip itself, the operators are laid out as follows:
@@ -103,4 +153,11 @@ typedef struct
 // Storage spot for interpreted OPL status
 extern oplChip oplStatus;
 
+// Everything needed to put the chip back exactly how it was - key-on and rhythm state live in the registers, so they come along for free
+struct oplSnapshot
+{
+	char registers[OPL_REGISTER_SPACE];	// Copy of oplRegisterSpace, every bank of every chip
+	oplChip status;			// Copy of oplStatus
+};
+
 #endif
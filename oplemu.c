@@ -0,0 +1,1261 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// OPLEMU.C - Software OPL2/OPL3 emulator
+//
+// This works the way the real chip does it, as worked out by the folks who
+// decapped it (see Nuked OPL3 by Nuke.YKT, which this follows closely):
+// sine and exponent lookups in the log domain, a 9-bit envelope attenuation,
+// and a 10-bit phase.  Everything is integer math, so the same register writes
+// always give exactly the same samples no matter what machine it runs on.
+//
+// Because it follows Nuked OPL3 so closely, this file and OPLEMU.H are a
+// derived work of it, and are under its license rather than VGMSlap's MIT one:
+//
+//   Copyright (C) 2013-2020 Nuke.YKT
+//
+//   This program is free software; you can redistribute it and/or modify it
+//   under the terms of the GNU Lesser General Public License as published by
+//   the Free Software Foundation; either version 2.1 of the License, or (at
+//   your option) any later version.
+//
+//   This program is distributed in the hope that it will be useful, but
+//   WITHOUT ANY WARRANTY; without even the implied warranty of
+//   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+//   General Public License for more details.
+//
+//   You should have received a copy of the GNU Lesser General Public License
+//   along with this program (COPYING.LIB); if not, write to the Free Software
+//   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "oplemu.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// The log-sin, exponent and waveform tables are in OPLTAB.C, made by MKTABLES.C when building
+
+// Frequency multiplier register value to actual multiplier (x2, so 0.5 fits)
+const uint8_t oplEmuMultiplier[16] = {1, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 24, 24, 30, 30};
+
+// Key scale level attenuation by the top 4 bits of the F-number
+const uint8_t oplEmuKslTable[16] = {0, 32, 40, 45, 48, 51, 53, 56, 56, 58, 59, 60, 61, 62, 63, 64};
+
+// KSL register value to how far to shift the attenuation (0 = off, then 3, 1.5 and 6 dB/oct)
+const uint8_t oplEmuKslShift[4] = {8, 1, 2, 0};
+
+// Fine envelope step pattern for the fast rates, by rate low bits and timer low bits
+const uint8_t oplEmuEgIncStep[4][4] = {
+	{0, 0, 0, 0},
+	{1, 0, 0, 0},
+	{1, 0, 1, 0},
+	{1, 1, 1, 0}
+};
+
+// Register offset (0x00-0x1F from the base of 0x20/0x40/0x60/0x80/0xE0) to operator number.  The gaps don't exist on the chip.
+const int8_t oplEmuRegisterToSlot[32] = {
+	0, 1, 2, 3, 4, 5, -1, -1, 6, 7, 8, 9, 10, 11, -1, -1,
+	12, 13, 14, 15, 16, 17, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+// First operator of each channel.  The second is always 3 operators after it.
+const uint8_t oplEmuChannelSlot[18] = {0, 1, 2, 6, 7, 8, 12, 13, 14, 18, 19, 20, 24, 25, 26, 30, 31, 32};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void oplEmuReset(oplEmuChip *chip, uint8_t chipType)
+{
+	uint8_t i;
+	oplEmuSlot *slot;
+	oplEmuChannel *channel;
+
+	memset(chip, 0, sizeof(oplEmuChip));
+	chip->chipType = chipType;
+	chip->stemMask[0] = (int16_t)0xFFFF;
+	chip->stemMask[1] = (int16_t)0xFFFF;
+
+	for (i = 0; i < 36; i++)
+	{
+		slot = &chip->slots[i];
+		slot->chip = chip;
+		slot->mod = &chip->zeroMod;
+		slot->egRout = 0x1FF;
+		slot->egOut = 0x1FF;
+		slot->egGen = OPL_EMU_EG_RELEASE;
+		slot->trem = &chip->zeroTrem;
+		slot->slotNum = i;
+	}
+	for (i = 0; i < 18; i++)
+	{
+		channel = &chip->channels[i];
+		channel->slots[0] = &chip->slots[oplEmuChannelSlot[i]];
+		channel->slots[1] = &chip->slots[oplEmuChannelSlot[i] + 3];
+		chip->slots[oplEmuChannelSlot[i]].channel = channel;
+		chip->slots[oplEmuChannelSlot[i] + 3].channel = channel;
+		// 4-op pairs are channels 1+4, 2+5, 3+6 on each bank
+		if ((i % 9) < 3)
+		{
+			channel->pair = &chip->channels[i + 3];
+		}
+		else if ((i % 9) < 6)
+		{
+			channel->pair = &chip->channels[i - 3];
+		}
+		channel->chip = chip;
+		channel->out[0] = &chip->zeroMod;
+		channel->out[1] = &chip->zeroMod;
+		channel->out[2] = &chip->zeroMod;
+		channel->out[3] = &chip->zeroMod;
+		channel->chType = OPL_EMU_CH_2OP;
+		channel->cha = 0xFFFF;
+		channel->chb = 0xFFFF;
+		channel->chNum = i;
+		oplEmuChannelSetupAlg(channel);
+	}
+	chip->noise = 1;
+	chip->vibShift = 1;
+	chip->tremoloShift = 4;
+}
+
+void oplEmuEnvelopeUpdateKsl(oplEmuSlot *slot)
+{
+	int16_t ksl = (oplEmuKslTable[slot->channel->fNum >> 6] << 2) - ((0x08 - slot->channel->block) << 5);
+
+	if (ksl < 0)
+	{
+		ksl = 0;
+	}
+	slot->egKsl = (uint8_t)ksl;
+	oplEmuSlotUpdate(slot);
+}
+
+void oplEmuSlotUpdate(oplEmuSlot *slot)
+{
+	oplEmuChannel *channel = slot->channel;
+
+	// Everything here only changes on a register write, so there's no point working it out again every sample
+	// (Vibrato only moves every 1024 samples, so oplEmuClock takes care of that through oplEmuUpdateVibrato)
+	if (slot->regVib)
+	{
+		slot->pgInc = oplEmuVibratoInc(slot);
+	}
+	else
+	{
+		slot->pgInc = (((((uint32_t)channel->fNum << channel->block) >> 1) * oplEmuMultiplier[slot->regMult]) >> 1);
+	}
+	slot->egKs = channel->ksv >> ((slot->regKsr ^ 1) << 1);
+	slot->egTlKsl = (slot->regTl << 2) + (slot->egKsl >> oplEmuKslShift[slot->regKsl]);
+}
+
+void oplEmuGenerate(oplEmuChip *chip, int16_t *left, int16_t *right)
+{
+	uint8_t i;
+	uint8_t shift;
+	uint8_t regRate;
+	uint8_t rateHi;
+	uint8_t rateLo;
+	uint8_t reset;
+	uint8_t egOff;
+	uint8_t idle;
+	uint8_t idleSlots = 0;
+	uint8_t fb;
+	uint16_t phase;
+	uint16_t wave;
+	uint16_t level;
+	uint16_t out;
+	uint16_t rmXor;
+	uint32_t inc;
+	uint32_t noise = chip->noise;
+	int16_t egRout;
+	int16_t egInc;
+	int16_t egOut;
+	int16_t accm;
+	int32_t mixLeft = 0;
+	int32_t mixRight = 0;
+	oplEmuSlot *slot;
+	oplEmuChannel *channel;
+
+	// All 36 operators in one go.  Each one does feedback, envelope, phase and output in that order, exactly like the chip.
+	// It's all in one loop rather than a function per step because calls are expensive on a 16-bit CPU, and lookups beat branches.
+	for (i = 0, slot = chip->slots; i < 36; i++, slot++)
+	{
+		channel = slot->channel;
+
+		// Feedback is the average of the last two outputs, scaled by the FB setting
+		fb = channel->fb;
+		if (fb != 0)
+		{
+			slot->fbmod = (slot->prout + slot->out) >> (0x09 - fb);
+		}
+		else
+		{
+			slot->fbmod = 0;
+		}
+		slot->prout = slot->out;
+
+		// Envelope generator
+		// An operator that's been released all the way down can't do anything until it's keyed on again (and any
+		// register write brings it back here to be checked), so leave its envelope alone and don't bother with the level lookup
+		if (slot->egGen == OPL_EMU_EG_RELEASE && !slot->key && slot->egRout == 0x1FF)
+		{
+			idle = 1;
+			idleSlots++;
+			reset = 0;
+			egOut = 0x1FF;
+		}
+		// Fast quality only runs the envelope every other sample, on the ones where the slow rates get to step.
+		// In between it just reuses the last attenuation, tremolo and all - unless a key-on or key-off is waiting,
+		// so notes still start and stop on the right sample.
+		else if (chip->quality == OPL_EMU_QUALITY_FAST && !chip->egState && (slot->key != 0) == (slot->egGen != OPL_EMU_EG_RELEASE))
+		{
+			idle = 0;
+			reset = 0;
+			egOut = slot->egOut;
+		}
+		else
+		{
+			idle = 0;
+			// A key-on while releasing restarts the note in attack
+			reset = 0;
+			regRate = 0;
+			if (slot->key && slot->egGen == OPL_EMU_EG_RELEASE)
+			{
+				reset = 1;
+				regRate = slot->regAr;
+			}
+			else
+			{
+				switch (slot->egGen)
+				{
+					case OPL_EMU_EG_ATTACK:
+						regRate = slot->regAr;
+						break;
+					case OPL_EMU_EG_DECAY:
+						regRate = slot->regDr;
+						break;
+					case OPL_EMU_EG_SUSTAIN:
+						// Sustaining sounds hold here until key-off, percussive ones keep going at the release rate
+						if (!slot->regType)
+						{
+							regRate = slot->regRr;
+						}
+						break;
+					case OPL_EMU_EG_RELEASE:
+						regRate = slot->regRr;
+						break;
+				}
+			}
+
+			shift = 0;
+			rateHi = (slot->egKs + (regRate << 2)) >> 2;
+			rateLo = slot->egKs & 0x03;
+			if (rateHi & 0x10)
+			{
+				rateHi = 0x0F;
+			}
+			if (regRate != 0)
+			{
+				// Slow rates step once every so many samples...
+				if (rateHi < 12)
+				{
+					if (chip->egState)
+					{
+						switch (rateHi + chip->egAdd)
+						{
+							case 12:
+								shift = 1;
+								break;
+							case 13:
+								shift = (rateLo >> 1) & 0x01;
+								break;
+							case 14:
+								shift = rateLo & 0x01;
+								break;
+						}
+					}
+				}
+				// ...fast rates step every sample, by more than one
+				else
+				{
+					shift = (rateHi & 0x03) + oplEmuEgIncStep[rateLo][chip->egTimerLo];
+					if (shift & 0x04)
+					{
+						shift = 0x03;
+					}
+					if (!shift)
+					{
+						shift = chip->egState;
+					}
+				}
+			}
+
+			egRout = slot->egRout;
+			egInc = 0;
+			egOff = 0;
+			// Rate 15 attack is instant
+			if (reset && rateHi == 0x0F)
+			{
+				egRout = 0;
+			}
+			// Close enough to silent counts as fully off
+			if ((slot->egRout & 0x1F8) == 0x1F8)
+			{
+				egOff = 1;
+			}
+			if (slot->egGen != OPL_EMU_EG_ATTACK && !reset && egOff)
+			{
+				egRout = 0x1FF;
+			}
+			switch (slot->egGen)
+			{
+				case OPL_EMU_EG_ATTACK:
+					if (!slot->egRout)
+					{
+						slot->egGen = OPL_EMU_EG_DECAY;
+					}
+					else if (slot->key && shift > 0 && rateHi != 0x0F)
+					{
+						// Attack is exponential - the step shrinks as it gets louder
+						egInc = (int16_t)(~slot->egRout) >> (4 - shift);
+						// Fast quality has to catch up on the step it skipped
+						if (chip->quality == OPL_EMU_QUALITY_FAST && rateHi >= 12)
+						{
+							egInc += (int16_t)(~(slot->egRout + egInc)) >> (4 - shift);
+						}
+					}
+					break;
+				case OPL_EMU_EG_DECAY:
+					if ((slot->egRout >> 4) == slot->regSl)
+					{
+						slot->egGen = OPL_EMU_EG_SUSTAIN;
+					}
+					else if (!egOff && !reset && shift > 0)
+					{
+						egInc = 1 << (shift - 1);
+					}
+					break;
+				case OPL_EMU_EG_SUSTAIN:
+				case OPL_EMU_EG_RELEASE:
+					if (!egOff && !reset && shift > 0)
+					{
+						egInc = 1 << (shift - 1);
+					}
+					break;
+			}
+			// Decay and release steps are never more than 4, so doubling them can't skip over the sustain level
+			if (chip->quality == OPL_EMU_QUALITY_FAST && rateHi >= 12 && egInc > 0)
+			{
+				egInc <<= 1;
+			}
+			slot->egRout = (egRout + egInc) & 0x1FF;
+			if (reset)
+			{
+				slot->egGen = OPL_EMU_EG_ATTACK;
+			}
+			if (!slot->key)
+			{
+				slot->egGen = OPL_EMU_EG_RELEASE;
+			}
+			// Add the fixed attenuation on top: total level and key scaling (worked out in advance), and tremolo
+			egOut = slot->egRout + slot->egTlKsl + *slot->trem;
+			if (egOut > 0x1FF)
+			{
+				egOut = 0x1FF;
+			}
+		}
+		slot->egOut = egOut;
+
+		// Phase generator
+		inc = slot->pgInc;
+		phase = (uint16_t)(slot->pgPhase >> 9);
+		if (reset)
+		{
+			slot->pgPhase = 0;
+		}
+		slot->pgPhase = (slot->pgPhase + inc) & 0x7FFFFUL;	// The real accumulator is 19 bits
+
+		// Rhythm mode - the hi-hat, snare and cymbal get their phase from a mix of each other and the noise generator
+		if (i == 13)
+		{
+			chip->rmHhBit2 = (phase >> 2) & 0x01;
+			chip->rmHhBit3 = (phase >> 3) & 0x01;
+			chip->rmHhBit7 = (phase >> 7) & 0x01;
+			chip->rmHhBit8 = (phase >> 8) & 0x01;
+		}
+		if (chip->rhy & 0x20)
+		{
+			if (i == 17)
+			{
+				chip->rmTcBit3 = (phase >> 3) & 0x01;
+				chip->rmTcBit5 = (phase >> 5) & 0x01;
+			}
+			rmXor = (chip->rmHhBit2 ^ chip->rmHhBit7) | (chip->rmHhBit3 ^ chip->rmTcBit5) | (chip->rmTcBit3 ^ chip->rmTcBit5);
+			switch (i)
+			{
+				// Hi-hat
+				case 13:
+					phase = rmXor << 9;
+					if (rmXor ^ (noise & 0x01))
+					{
+						phase |= 0xD0;
+					}
+					else
+					{
+						phase |= 0x34;
+					}
+					break;
+				// Snare
+				case 16:
+					phase = (chip->rmHhBit8 << 9) | ((chip->rmHhBit8 ^ (noise & 0x01)) << 8);
+					break;
+				// Top cymbal
+				case 17:
+					phase = (rmXor << 9) | 0x80;
+					break;
+			}
+		}
+		// The noise generator steps once per operator
+		noise = (noise >> 1) | ((((noise >> 14) ^ noise) & 0x01) << 22);
+
+		// Operator output: waveform lookup (log domain, with the sign in the top bit), add the envelope, then back to linear
+		wave = oplEmuWaveTable[slot->regWf][(phase + *slot->mod) & 0x3FF];
+		// At full attenuation the level always shifts down to nothing, leaving just the sign - 0 or -1, same as the chip
+		if (idle)
+		{
+			out = 0;
+		}
+		else
+		{
+			level = (wave & 0x1FFF) + (egOut << 3);
+			out = (oplEmuExpTable[level & 0xFF] << 1) >> (level >> 8);
+		}
+		if (wave & 0x8000)
+		{
+			out = ~out;
+		}
+		slot->out = (int16_t)out;
+	}
+	chip->noise = noise;
+	chip->idleSlots = idleSlots;
+
+	for (i = 0, channel = chip->channels; i < 18; i++, channel++)
+	{
+		accm = *channel->out[0] + *channel->out[1] + *channel->out[2] + *channel->out[3];
+		mixLeft += (int16_t)(accm & channel->cha);
+		mixRight += (int16_t)(accm & channel->chb);
+	}
+	if (chip->stemOut != NULL)
+	{
+		oplEmuStemOutput(chip);
+	}
+	if (mixLeft > 32767)
+	{
+		mixLeft = 32767;
+	}
+	else if (mixLeft < -32768)
+	{
+		mixLeft = -32768;
+	}
+	if (mixRight > 32767)
+	{
+		mixRight = 32767;
+	}
+	else if (mixRight < -32768)
+	{
+		mixRight = -32768;
+	}
+	*left = (int16_t)mixLeft;
+	*right = (int16_t)mixRight;
+
+	oplEmuClock(chip);
+}
+
+void oplEmuClock(oplEmuChip *chip)
+{
+	uint8_t shift;
+
+	// Tremolo is a triangle wave 210 steps long, vibrato an 8 step pattern
+	if ((chip->timer & 0x3F) == 0x3F)
+	{
+		chip->tremoloPos = (chip->tremoloPos + 1) % 210;
+	}
+	if (chip->tremoloPos < 105)
+	{
+		chip->tremolo = chip->tremoloPos >> chip->tremoloShift;
+	}
+	else
+	{
+		chip->tremolo = (210 - chip->tremoloPos) >> chip->tremoloShift;
+	}
+	// Vibrato only moves every 1024 samples, so only work out what it does to the phase steps when it does
+	if ((chip->timer & 0x3FF) == 0x3FF)
+	{
+		chip->vibPos = (chip->vibPos + 1) & 0x07;
+		oplEmuUpdateVibrato(chip);
+	}
+	chip->timer++;
+
+	// The envelope timer ticks every other sample.  Slow rates use how many trailing zeroes it has to decide when to step.
+	shift = 0;
+	if (chip->egState)
+	{
+		while (shift < 13 && ((chip->egTimer >> shift) & 0x01) == 0)
+		{
+			shift++;
+		}
+		if (shift > 12)
+		{
+			chip->egAdd = 0;
+		}
+		else
+		{
+			chip->egAdd = shift + 1;
+		}
+		chip->egTimerLo = (uint8_t)(chip->egTimer & 0x03);
+	}
+	if (chip->egTimerRem || chip->egState)
+	{
+		chip->egTimer++;
+		chip->egTimerRem = 0;
+	}
+	chip->egState ^= 1;
+}
+
+void oplEmuGenerateBlock(oplEmuChip *chip, int16_t *left, int16_t *right, uint16_t frames)
+{
+	int16_t unused;
+
+	// Output goes into an interleaved stereo buffer, so step over the other side each time.
+	// A mono chip can pass NULL for the right side and it gets thrown away.
+	while (frames > 0)
+	{
+		// Every operator is silent, so until the next register write this chip outputs nothing at all
+		if (chip->skipSilence && chip->idleSlots == 36)
+		{
+			oplEmuSkipSilence(chip, frames);
+			// Stems start out zeroed, so there's nothing to write - just move past them
+			if (chip->stemOut != NULL)
+			{
+				chip->stemOut += (uint16_t)frames * OPL_EMU_STEMS * 2;
+			}
+			while (frames > 0)
+			{
+				*left = 0;
+				left += 2;
+				if (right != NULL)
+				{
+					*right = 0;
+					right += 2;
+				}
+				frames--;
+			}
+			break;
+		}
+		if (right == NULL)
+		{
+			oplEmuGenerate(chip, left, &unused);
+		}
+		else
+		{
+			oplEmuGenerate(chip, left, right);
+			right += 2;
+		}
+		left += 2;
+		frames--;
+	}
+}
+
+void oplEmuStemOutput(oplEmuChip *chip)
+{
+	uint8_t i;
+	uint8_t channels = 9;
+	int16_t accm;
+	int16_t left;
+	int16_t right;
+	int16_t *stem = chip->stemOut;
+	oplEmuChannel *channel;
+
+	if (chip->chipType == OPL_EMU_YMF262)
+	{
+		channels = 18;
+	}
+	// Same sums as the main mix, just kept apart.  Only this chip's channels get written - the rest were zeroed beforehand.
+	for (i = 0, channel = chip->channels; i < channels; i++, channel++)
+	{
+		// In rhythm mode channels 7-9 are the drums, which get stems of their own
+		if ((chip->rhy & 0x20) && i >= 6 && i <= 8)
+		{
+			continue;
+		}
+		accm = *channel->out[0] + *channel->out[1] + *channel->out[2] + *channel->out[3];
+		stem[(chip->stemBase + i) * 2] = accm & channel->cha & chip->stemMask[0];
+		stem[(chip->stemBase + i) * 2 + 1] = accm & channel->chb & chip->stemMask[1];
+	}
+	if (chip->rhy & 0x20)
+	{
+		// Bass drum is all of channel 7.  Channels 8 and 9 carry two drums each, one per operator (each counted twice, same as the
+		// main mix).  These add rather than overwrite, since both chips of a dual OPL2 share the same five drum stems.
+		channel = &chip->channels[6];
+		accm = *channel->out[0] + *channel->out[1];
+		stem[OPL_EMU_STEM_BD * 2] += accm & channel->cha & chip->stemMask[0];
+		stem[OPL_EMU_STEM_BD * 2 + 1] += accm & channel->chb & chip->stemMask[1];
+		channel = &chip->channels[7];
+		left = channel->cha & chip->stemMask[0];
+		right = channel->chb & chip->stemMask[1];
+		accm = *channel->out[0] + *channel->out[1];
+		stem[OPL_EMU_STEM_HH * 2] += accm & left;
+		stem[OPL_EMU_STEM_HH * 2 + 1] += accm & right;
+		accm = *channel->out[2] + *channel->out[3];
+		stem[OPL_EMU_STEM_SD * 2] += accm & left;
+		stem[OPL_EMU_STEM_SD * 2 + 1] += accm & right;
+		channel = &chip->channels[8];
+		left = channel->cha & chip->stemMask[0];
+		right = channel->chb & chip->stemMask[1];
+		accm = *channel->out[0] + *channel->out[1];
+		stem[OPL_EMU_STEM_TT * 2] += accm & left;
+		stem[OPL_EMU_STEM_TT * 2 + 1] += accm & right;
+		accm = *channel->out[2] + *channel->out[3];
+		stem[OPL_EMU_STEM_CY * 2] += accm & left;
+		stem[OPL_EMU_STEM_CY * 2 + 1] += accm & right;
+	}
+	chip->stemOut += OPL_EMU_STEMS * 2;
+}
+
+void oplEmuSkipSilence(oplEmuChip *chip, uint16_t frames)
+{
+	uint8_t i;
+	uint8_t vibSlots = 0;
+	uint16_t tcPhase = 0;
+	uint32_t inc;
+	uint32_t noise = chip->noise;
+	oplEmuSlot *slot;
+
+	// Nothing can be heard, but the phases, LFOs, envelope timer and noise generator all keep running
+	// so everything is exactly where it should be when the next note starts.
+	chip->silentSamples += frames;
+
+	// Operators without vibrato move by the same amount every sample, so they can jump straight to the end.
+	// The ones with vibrato have to go a sample at a time in case it moves partway through.
+	for (i = 0, slot = chip->slots; i < 36; i++, slot++)
+	{
+		if (slot->regVib)
+		{
+			vibSlots++;
+		}
+		else
+		{
+			slot->pgPhase = (slot->pgPhase + slot->pgInc * frames) & 0x7FFFFUL;
+		}
+	}
+	// The top cymbal's phase from the last sample feeds the hi-hat on the next one
+	slot = &chip->slots[17];
+	if (!slot->regVib)
+	{
+		tcPhase = (uint16_t)(((slot->pgPhase - slot->pgInc) & 0x7FFFFUL) >> 9);
+	}
+
+	while (frames > 0)
+	{
+		if (vibSlots > 0)
+		{
+			for (i = 0, slot = chip->slots; i < 36; i++, slot++)
+			{
+				if (slot->regVib)
+				{
+					inc = slot->pgInc;
+					if (i == 17)
+					{
+						tcPhase = (uint16_t)(slot->pgPhase >> 9);
+					}
+					slot->pgPhase = (slot->pgPhase + inc) & 0x7FFFFUL;
+				}
+			}
+		}
+		for (i = 0; i < 36; i++)
+		{
+			noise = (noise >> 1) | ((((noise >> 14) ^ noise) & 0x01) << 22);
+		}
+		oplEmuClock(chip);
+		frames--;
+	}
+	chip->noise = noise;
+	if (chip->rhy & 0x20)
+	{
+		chip->rmTcBit3 = (tcPhase >> 3) & 0x01;
+		chip->rmTcBit5 = (tcPhase >> 5) & 0x01;
+	}
+}
+
+void oplEmuUpdateVibrato(oplEmuChip *chip)
+{
+	uint8_t i;
+	oplEmuSlot *slot;
+
+	for (i = 0, slot = chip->slots; i < 36; i++, slot++)
+	{
+		if (slot->regVib)
+		{
+			slot->pgInc = oplEmuVibratoInc(slot);
+		}
+	}
+}
+
+uint32_t oplEmuVibratoInc(oplEmuSlot *slot)
+{
+	oplEmuChannel *channel = slot->channel;
+	oplEmuChip *chip = slot->chip;
+	uint16_t fNum = channel->fNum;
+	uint16_t range = (fNum >> 7) & 0x07;
+	uint8_t vibPos = chip->vibPos;
+
+	// Vibrato nudges the F-number up and down by a fraction of its top bits
+	if (!(vibPos & 0x03))
+	{
+		range = 0;
+	}
+	else if (vibPos & 0x01)
+	{
+		range >>= 1;
+	}
+	range >>= chip->vibShift;
+	if (vibPos & 0x04)
+	{
+		fNum -= range;
+	}
+	else
+	{
+		fNum += range;
+	}
+	return (((((uint32_t)fNum << channel->block) >> 1) * oplEmuMultiplier[slot->regMult]) >> 1);
+}
+
+void oplEmuKeyOn(oplEmuSlot *slot, uint8_t type)
+{
+	slot->key |= type;
+}
+
+void oplEmuKeyOff(oplEmuSlot *slot, uint8_t type)
+{
+	slot->key &= ~type;
+}
+
+void oplEmuChannelSetupAlg(oplEmuChannel *channel)
+{
+	oplEmuChip *chip = channel->chip;
+
+	if (channel->chType == OPL_EMU_CH_DRUM)
+	{
+		// Hi-hat/snare and tom/cymbal are two independent operators with no modulation
+		if (channel->chNum == 7 || channel->chNum == 8)
+		{
+			channel->slots[0]->mod = &chip->zeroMod;
+			channel->slots[1]->mod = &chip->zeroMod;
+			return;
+		}
+		// Bass drum works like a normal channel
+		if (channel->alg & 0x01)
+		{
+			channel->slots[0]->mod = &channel->slots[0]->fbmod;
+			channel->slots[1]->mod = &chip->zeroMod;
+		}
+		else
+		{
+			channel->slots[0]->mod = &channel->slots[0]->fbmod;
+			channel->slots[1]->mod = &channel->slots[0]->out;
+		}
+		return;
+	}
+	// First half of a 4-op pair - its partner handles everything
+	if (channel->alg & 0x08)
+	{
+		return;
+	}
+	// 4-op - this is the second channel of the pair, the chain starts on the first
+	if (channel->alg & 0x04)
+	{
+		channel->pair->out[0] = &chip->zeroMod;
+		channel->pair->out[1] = &chip->zeroMod;
+		channel->pair->out[2] = &chip->zeroMod;
+		channel->pair->out[3] = &chip->zeroMod;
+		switch (channel->alg & 0x03)
+		{
+			// FM-FM: 1 -> 2 -> 3 -> 4
+			case 0x00:
+				channel->pair->slots[0]->mod = &channel->pair->slots[0]->fbmod;
+				channel->pair->slots[1]->mod = &channel->pair->slots[0]->out;
+				channel->slots[0]->mod = &channel->pair->slots[1]->out;
+				channel->slots[1]->mod = &channel->slots[0]->out;
+				channel->out[0] = &channel->slots[1]->out;
+				channel->out[1] = &chip->zeroMod;
+				channel->out[2] = &chip->zeroMod;
+				channel->out[3] = &chip->zeroMod;
+				break;
+			// FM-AM: (1 -> 2) + (3 -> 4)
+			case 0x01:
+				channel->pair->slots[0]->mod = &channel->pair->slots[0]->fbmod;
+				channel->pair->slots[1]->mod = &channel->pair->slots[0]->out;
+				channel->slots[0]->mod = &chip->zeroMod;
+				channel->slots[1]->mod = &channel->slots[0]->out;
+				channel->out[0] = &channel->pair->slots[1]->out;
+				channel->out[1] = &channel->slots[1]->out;
+				channel->out[2] = &chip->zeroMod;
+				channel->out[3] = &chip->zeroMod;
+				break;
+			// AM-FM: 1 + (2 -> 3 -> 4)
+			case 0x02:
+				channel->pair->slots[0]->mod = &channel->pair->slots[0]->fbmod;
+				channel->pair->slots[1]->mod = &chip->zeroMod;
+				channel->slots[0]->mod = &channel->pair->slots[1]->out;
+				channel->slots[1]->mod = &channel->slots[0]->out;
+				channel->out[0] = &channel->pair->slots[0]->out;
+				channel->out[1] = &channel->slots[1]->out;
+				channel->out[2] = &chip->zeroMod;
+				channel->out[3] = &chip->zeroMod;
+				break;
+			// AM-AM: 1 + (2 -> 3) + 4
+			case 0x03:
+				channel->pair->slots[0]->mod = &channel->pair->slots[0]->fbmod;
+				channel->pair->slots[1]->mod = &chip->zeroMod;
+				channel->slots[0]->mod = &channel->pair->slots[1]->out;
+				channel->slots[1]->mod = &chip->zeroMod;
+				channel->out[0] = &channel->pair->slots[0]->out;
+				channel->out[1] = &channel->slots[0]->out;
+				channel->out[2] = &channel->slots[1]->out;
+				channel->out[3] = &chip->zeroMod;
+				break;
+		}
+	}
+	// Plain 2-op
+	else
+	{
+		if (channel->alg & 0x01)
+		{
+			// Additive: both operators go to the output
+			channel->slots[0]->mod = &channel->slots[0]->fbmod;
+			channel->slots[1]->mod = &chip->zeroMod;
+			channel->out[0] = &channel->slots[0]->out;
+			channel->out[1] = &channel->slots[1]->out;
+		}
+		else
+		{
+			// FM: operator 1 modulates operator 2
+			channel->slots[0]->mod = &channel->slots[0]->fbmod;
+			channel->slots[1]->mod = &channel->slots[0]->out;
+			channel->out[0] = &channel->slots[1]->out;
+			channel->out[1] = &chip->zeroMod;
+		}
+		channel->out[2] = &chip->zeroMod;
+		channel->out[3] = &chip->zeroMod;
+	}
+}
+
+void oplEmuChannelUpdateAlg(oplEmuChannel *channel)
+{
+	channel->alg = channel->con;
+	if (channel->chip->newm)
+	{
+		if (channel->chType == OPL_EMU_CH_4OP)
+		{
+			channel->pair->alg = 0x04 | (channel->con << 1) | channel->pair->con;
+			channel->alg = 0x08;
+			oplEmuChannelSetupAlg(channel->pair);
+			return;
+		}
+		else if (channel->chType == OPL_EMU_CH_4OP2)
+		{
+			channel->alg = 0x04 | (channel->pair->con << 1) | channel->con;
+			channel->pair->alg = 0x08;
+		}
+	}
+	oplEmuChannelSetupAlg(channel);
+}
+
+void oplEmuChannelKeyOn(oplEmuChannel *channel)
+{
+	if (channel->chip->newm)
+	{
+		// The first channel of a 4-op pair keys on all four operators, the second one's key-on bit does nothing
+		if (channel->chType == OPL_EMU_CH_4OP)
+		{
+			oplEmuKeyOn(channel->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOn(channel->slots[1], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOn(channel->pair->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOn(channel->pair->slots[1], OPL_EMU_KEY_NORMAL);
+		}
+		else if (channel->chType == OPL_EMU_CH_2OP || channel->chType == OPL_EMU_CH_DRUM)
+		{
+			oplEmuKeyOn(channel->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOn(channel->slots[1], OPL_EMU_KEY_NORMAL);
+		}
+	}
+	else
+	{
+		oplEmuKeyOn(channel->slots[0], OPL_EMU_KEY_NORMAL);
+		oplEmuKeyOn(channel->slots[1], OPL_EMU_KEY_NORMAL);
+	}
+}
+
+void oplEmuChannelKeyOff(oplEmuChannel *channel)
+{
+	if (channel->chip->newm)
+	{
+		if (channel->chType == OPL_EMU_CH_4OP)
+		{
+			oplEmuKeyOff(channel->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOff(channel->slots[1], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOff(channel->pair->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOff(channel->pair->slots[1], OPL_EMU_KEY_NORMAL);
+		}
+		else if (channel->chType == OPL_EMU_CH_2OP || channel->chType == OPL_EMU_CH_DRUM)
+		{
+			oplEmuKeyOff(channel->slots[0], OPL_EMU_KEY_NORMAL);
+			oplEmuKeyOff(channel->slots[1], OPL_EMU_KEY_NORMAL);
+		}
+	}
+	else
+	{
+		oplEmuKeyOff(channel->slots[0], OPL_EMU_KEY_NORMAL);
+		oplEmuKeyOff(channel->slots[1], OPL_EMU_KEY_NORMAL);
+	}
+}
+
+void oplEmuChannelUpdateFrequency(oplEmuChannel *channel)
+{
+	channel->ksv = (channel->block << 1) | ((channel->fNum >> (0x09 - channel->chip->nts)) & 0x01);
+	oplEmuEnvelopeUpdateKsl(channel->slots[0]);
+	oplEmuEnvelopeUpdateKsl(channel->slots[1]);
+	// In 4-op mode the second channel plays at the first one's frequency
+	if (channel->chip->newm && channel->chType == OPL_EMU_CH_4OP)
+	{
+		channel->pair->fNum = channel->fNum;
+		channel->pair->block = channel->block;
+		channel->pair->ksv = channel->ksv;
+		oplEmuEnvelopeUpdateKsl(channel->pair->slots[0]);
+		oplEmuEnvelopeUpdateKsl(channel->pair->slots[1]);
+	}
+}
+
+void oplEmuSet4Op(oplEmuChip *chip, uint8_t data)
+{
+	uint8_t bit;
+	uint8_t channelNum;
+
+	// Bits 0-2 are channels 1-3, bits 3-5 are channels 10-12
+	for (bit = 0; bit < 6; bit++)
+	{
+		channelNum = bit;
+		if (bit >= 3)
+		{
+			channelNum += 9 - 3;
+		}
+		if ((data >> bit) & 0x01)
+		{
+			chip->channels[channelNum].chType = OPL_EMU_CH_4OP;
+			chip->channels[channelNum + 3].chType = OPL_EMU_CH_4OP2;
+			oplEmuChannelUpdateAlg(&chip->channels[channelNum]);
+		}
+		else
+		{
+			chip->channels[channelNum].chType = OPL_EMU_CH_2OP;
+			chip->channels[channelNum + 3].chType = OPL_EMU_CH_2OP;
+			oplEmuChannelUpdateAlg(&chip->channels[channelNum]);
+			oplEmuChannelUpdateAlg(&chip->channels[channelNum + 3]);
+		}
+	}
+}
+
+void oplEmuUpdateRhythm(oplEmuChip *chip, uint8_t data)
+{
+	oplEmuChannel *channel6 = &chip->channels[6];
+	oplEmuChannel *channel7 = &chip->channels[7];
+	oplEmuChannel *channel8 = &chip->channels[8];
+	uint8_t i;
+
+	chip->rhy = data & 0x3F;
+	if (chip->rhy & 0x20)
+	{
+		// Rhythm mode: channel 7 becomes bass drum, 8 hi-hat and snare, 9 tom and cymbal
+		channel6->out[0] = &channel6->slots[1]->out;
+		channel6->out[1] = &channel6->slots[1]->out;
+		channel6->out[2] = &chip->zeroMod;
+		channel6->out[3] = &chip->zeroMod;
+		channel7->out[0] = &channel7->slots[0]->out;
+		channel7->out[1] = &channel7->slots[0]->out;
+		channel7->out[2] = &channel7->slots[1]->out;
+		channel7->out[3] = &channel7->slots[1]->out;
+		channel8->out[0] = &channel8->slots[0]->out;
+		channel8->out[1] = &channel8->slots[0]->out;
+		channel8->out[2] = &channel8->slots[1]->out;
+		channel8->out[3] = &channel8->slots[1]->out;
+		for (i = 6; i < 9; i++)
+		{
+			chip->channels[i].chType = OPL_EMU_CH_DRUM;
+		}
+		oplEmuChannelSetupAlg(channel6);
+		oplEmuChannelSetupAlg(channel7);
+		oplEmuChannelSetupAlg(channel8);
+		// Hi-hat
+		if (chip->rhy & 0x01)
+		{
+			oplEmuKeyOn(channel7->slots[0], OPL_EMU_KEY_DRUM);
+		}
+		else
+		{
+			oplEmuKeyOff(channel7->slots[0], OPL_EMU_KEY_DRUM);
+		}
+		// Top cymbal
+		if (chip->rhy & 0x02)
+		{
+			oplEmuKeyOn(channel8->slots[1], OPL_EMU_KEY_DRUM);
+		}
+		else
+		{
+			oplEmuKeyOff(channel8->slots[1], OPL_EMU_KEY_DRUM);
+		}
+		// Tom-tom
+		if (chip->rhy & 0x04)
+		{
+			oplEmuKeyOn(channel8->slots[0], OPL_EMU_KEY_DRUM);
+		}
+		else
+		{
+			oplEmuKeyOff(channel8->slots[0], OPL_EMU_KEY_DRUM);
+		}
+		// Snare drum
+		if (chip->rhy & 0x08)
+		{
+			oplEmuKeyOn(channel7->slots[1], OPL_EMU_KEY_DRUM);
+		}
+		else
+		{
+			oplEmuKeyOff(channel7->slots[1], OPL_EMU_KEY_DRUM);
+		}
+		// Bass drum
+		if (chip->rhy & 0x10)
+		{
+			oplEmuKeyOn(channel6->slots[0], OPL_EMU_KEY_DRUM);
+			oplEmuKeyOn(channel6->slots[1], OPL_EMU_KEY_DRUM);
+		}
+		else
+		{
+			oplEmuKeyOff(channel6->slots[0], OPL_EMU_KEY_DRUM);
+			oplEmuKeyOff(channel6->slots[1], OPL_EMU_KEY_DRUM);
+		}
+	}
+	else
+	{
+		for (i = 6; i < 9; i++)
+		{
+			chip->channels[i].chType = OPL_EMU_CH_2OP;
+			oplEmuChannelSetupAlg(&chip->channels[i]);
+			oplEmuKeyOff(chip->channels[i].slots[0], OPL_EMU_KEY_DRUM);
+			oplEmuKeyOff(chip->channels[i].slots[1], OPL_EMU_KEY_DRUM);
+		}
+	}
+}
+
+void oplEmuWrite(oplEmuChip *chip, uint16_t reg, uint8_t data)
+{
+	uint8_t high = (reg >> 8) & 0x01;
+	uint8_t regm = reg & 0xFF;
+	int8_t slotNum;
+	oplEmuSlot *slot = NULL;
+	oplEmuChannel *channel = NULL;
+
+	// Anything could have changed, so the next sample has to look at every operator again
+	chip->idleSlots = 0;
+
+	// The YM3812 only has the one register bank
+	if (high && chip->chipType == OPL_EMU_YM3812)
+	{
+		return;
+	}
+
+	// Operator registers - find which operator this is for
+	if ((regm >= 0x20 && regm < 0xA0) || regm >= 0xE0)
+	{
+		slotNum = oplEmuRegisterToSlot[regm & 0x1F];
+		if (slotNum < 0)
+		{
+			return;
+		}
+		slot = &chip->slots[18 * high + slotNum];
+	}
+	// Channel registers
+	else if (regm >= 0xA0 && regm < 0xD0 && (regm & 0x0F) < 9)
+	{
+		channel = &chip->channels[9 * high + (regm & 0x0F)];
+	}
+
+	switch (regm & 0xF0)
+	{
+		case 0x00:
+			if (high)
+			{
+				switch (regm & 0x0F)
+				{
+					case 0x04:
+						oplEmuSet4Op(chip, data);
+						break;
+					case 0x05:
+						chip->newm = data & 0x01;
+						break;
+				}
+			}
+			else
+			{
+				switch (regm & 0x0F)
+				{
+					case 0x01:
+						chip->wse = (data >> 5) & 0x01;
+						// Turning it off on a real YM3812 puts every operator back on a plain sine wave, not just new writes
+						if (!chip->wse && chip->chipType == OPL_EMU_YM3812)
+						{
+							for (slotNum = 0; slotNum < 18; slotNum++)
+							{
+								chip->slots[slotNum].regWf = 0;
+							}
+						}
+						break;
+					case 0x08:
+						chip->nts = (data >> 6) & 0x01;
+						break;
+				}
+			}
+			break;
+		// Tremolo / Vibrato / Sustain / KSR / Multiplier
+		case 0x20:
+		case 0x30:
+			if ((data >> 7) & 0x01)
+			{
+				slot->trem = &chip->tremolo;
+			}
+			else
+			{
+				slot->trem = &chip->zeroTrem;
+			}
+			slot->regVib = (data >> 6) & 0x01;
+			slot->regType = (data >> 5) & 0x01;
+			slot->regKsr = (data >> 4) & 0x01;
+			slot->regMult = data & 0x0F;
+			oplEmuSlotUpdate(slot);
+			break;
+		// Key Scale / Output Level
+		case 0x40:
+		case 0x50:
+			slot->regKsl = (data >> 6) & 0x03;
+			slot->regTl = data & 0x3F;
+			oplEmuEnvelopeUpdateKsl(slot);
+			break;
+		// Attack / Decay
+		case 0x60:
+		case 0x70:
+			slot->regAr = (data >> 4) & 0x0F;
+			slot->regDr = data & 0x0F;
+			break;
+		// Sustain / Release
+		case 0x80:
+		case 0x90:
+			slot->regSl = (data >> 4) & 0x0F;
+			if (slot->regSl == 0x0F)
+			{
+				slot->regSl = 0x1F;
+			}
+			slot->regRr = data & 0x0F;
+			break;
+		// Waveform Select
+		case 0xE0:
+		case 0xF0:
+			if (chip->chipType == OPL_EMU_YM3812)
+			{
+				// The OPL2 ignores waveform writes unless they've been enabled in 0x01
+				if (chip->wse)
+				{
+					slot->regWf = data & 0x03;
+				}
+			}
+			else if (chip->newm)
+			{
+				slot->regWf = data & 0x07;
+			}
+			else
+			{
+				slot->regWf = data & 0x03;
+			}
+			break;
+		// Frequency number (LSB)
+		case 0xA0:
+			if (channel == NULL || (chip->newm && channel->chType == OPL_EMU_CH_4OP2))
+			{
+				break;
+			}
+			channel->fNum = (channel->fNum & 0x300) | data;
+			oplEmuChannelUpdateFrequency(channel);
+			break;
+		// Key-On + Block + Frequency (MSB), and the rhythm register
+		case 0xB0:
+			if (regm == 0xBD && !high)
+			{
+				chip->tremoloShift = (((data >> 7) ^ 1) << 1) + 2;
+				chip->vibShift = ((data >> 6) & 0x01) ^ 1;
+				oplEmuUpdateVibrato(chip);
+				oplEmuUpdateRhythm(chip, data);
+				break;
+			}
+			if (channel == NULL)
+			{
+				break;
+			}
+			if (!(chip->newm && channel->chType == OPL_EMU_CH_4OP2))
+			{
+				channel->fNum = (channel->fNum & 0xFF) | ((data & 0x03) << 8);
+				channel->block = (data >> 2) & 0x07;
+				oplEmuChannelUpdateFrequency(channel);
+			}
+			if (data & 0x20)
+			{
+				oplEmuChannelKeyOn(channel);
+			}
+			else
+			{
+				oplEmuChannelKeyOff(channel);
+			}
+			break;
+		// Panning, Feedback, Synthesis Type
+		case 0xC0:
+			if (channel == NULL)
+			{
+				break;
+			}
+			channel->fb = (data >> 1) & 0x07;
+			channel->con = data & 0x01;
+			oplEmuChannelUpdateAlg(channel);
+			if (chip->newm)
+			{
+				channel->cha = ((data >> 4) & 0x01) ? 0xFFFF : 0;
+				channel->chb = ((data >> 5) & 0x01) ? 0xFFFF : 0;
+			}
+			else
+			{
+				channel->cha = 0xFFFF;
+				channel->chb = 0xFFFF;
+			}
+			break;
+	}
+}
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// OPLEMU.H - Software OPL2/OPL3 emulator
+//
+// Derived from Nuked OPL3, Copyright (C) 2013-2020 Nuke.YKT, and licensed
+// under the GNU Lesser General Public License 2.1 or later like it is (see
+// OPLEMU.C and COPYING.LIB), not under VGMSlap's MIT license.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_OPLEMU_H
+#define VGMSLAP_OPLEMU_H
+
+#include "types.h"
+
+// The real chips run off a 14.31818MHz crystal and produce one sample every 288 clocks
+#define OPL_EMU_RATE 49716
+
+// Which chip a particular emulator instance is pretending to be
+#define OPL_EMU_YM3812 2
+#define OPL_EMU_YMF262 3
+
+// Envelope generator states
+#define OPL_EMU_EG_ATTACK 0
+#define OPL_EMU_EG_DECAY 1
+#define OPL_EMU_EG_SUSTAIN 2
+#define OPL_EMU_EG_RELEASE 3
+
+// Channel types - 4-op and rhythm mode change how the operators are wired together
+#define OPL_EMU_CH_2OP 0
+#define OPL_EMU_CH_4OP 1	// First channel of a 4-op pair (1-3, 10-12)
+#define OPL_EMU_CH_4OP2 2	// Second channel of a 4-op pair (4-6, 13-15)
+#define OPL_EMU_CH_DRUM 3	// Channels 7-9 in rhythm mode
+
+// Emulation quality - fast cuts corners on the envelope, accurate matches the chip exactly
+#define OPL_EMU_QUALITY_ACCURATE 0
+#define OPL_EMU_QUALITY_FAST 1
+
+// Separate outputs for stem rendering: one per channel, then the five rhythm mode drums
+#define OPL_EMU_STEMS 23
+#define OPL_EMU_STEM_BD 18
+#define OPL_EMU_STEM_SD 19
+#define OPL_EMU_STEM_TT 20
+#define OPL_EMU_STEM_CY 21
+#define OPL_EMU_STEM_HH 22
+
+// Where a key-on came from.  A rhythm operator can be keyed on by both 0xBD and its channel's 0xB0 register.
+#define OPL_EMU_KEY_NORMAL 0x01
+#define OPL_EMU_KEY_DRUM 0x02
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// Forward declarations so the operators, channels and chip can point at each other
+typedef struct oplEmuSlot oplEmuSlot;
+typedef struct oplEmuChannel oplEmuChannel;
+typedef struct oplEmuChip oplEmuChip;
+
+// One operator ("slot" in Yamaha's terms)
+struct oplEmuSlot
+{
+	oplEmuChannel *channel;
+	oplEmuChip *chip;
+	int16_t out;			// Output of this operator for the current sample
+	int16_t fbmod;			// Feedback modulation (first operator only)
+	int16_t prout;			// Previous output, used for feedback
+	int16_t *mod;			// Where the phase modulation comes from (another operator, feedback, or nothing)
+	int16_t egRout;			// Envelope attenuation before TL/KSL/tremolo (0 = loudest, 0x1FF = silent)
+	int16_t egOut;			// Final attenuation
+	uint8_t egGen;			// Envelope state (OPL_EMU_EG_*)
+	uint8_t egKsl;
+	uint8_t *trem;			// Points at the chip's tremolo value, or at zero if AM is off
+	uint8_t regVib;
+	uint8_t regType;		// EG type - 1 = hold at sustain level until key-off
+	uint8_t regKsr;
+	uint8_t regMult;
+	uint8_t regKsl;
+	uint8_t regTl;
+	uint8_t regAr;
+	uint8_t regDr;
+	uint8_t regSl;
+	uint8_t regRr;
+	uint8_t regWf;
+	uint8_t key;			// OPL_EMU_KEY_* bits
+	uint32_t pgPhase;		// Phase accumulator
+	uint8_t slotNum;
+	// Worked out by oplEmuSlotUpdate when registers change
+	uint32_t pgInc;			// Phase step per sample (including vibrato)
+	uint16_t egTlKsl;		// Total level plus key scale attenuation
+	uint8_t egKs;			// Key scale rate added to the envelope rates
+};
+
+// One 2-op channel
+struct oplEmuChannel
+{
+	oplEmuSlot *slots[2];
+	oplEmuChannel *pair;	// The other half of a 4-op pair
+	oplEmuChip *chip;
+	int16_t *out[4];		// Operator outputs summed into this channel
+	uint8_t chType;			// OPL_EMU_CH_*
+	uint16_t fNum;
+	uint8_t block;
+	uint8_t fb;
+	uint8_t con;
+	uint8_t alg;
+	uint8_t ksv;			// Key scale value, from block and the top of the F-number
+	uint16_t cha;			// Left output enable mask
+	uint16_t chb;			// Right output enable mask
+	uint8_t chNum;
+};
+
+// The whole chip
+struct oplEmuChip
+{
+	oplEmuChannel channels[18];
+	oplEmuSlot slots[36];
+	uint8_t chipType;		// OPL_EMU_YM3812 or OPL_EMU_YMF262
+	uint16_t timer;
+	uint32_t egTimer;
+	uint8_t egTimerRem;
+	uint8_t egState;
+	uint8_t egAdd;
+	uint8_t egTimerLo;
+	uint8_t newm;			// OPL3 mode (0x105 bit 0)
+	uint8_t nts;			// Note select (0x08 bit 6)
+	uint8_t wse;			// Waveform select enable (0x01 bit 5), only matters on the YM3812
+	uint8_t rhy;			// Rhythm mode bits from 0xBD
+	uint8_t vibPos;
+	uint8_t vibShift;
+	uint8_t tremolo;
+	uint8_t tremoloPos;
+	uint8_t tremoloShift;
+	uint32_t noise;			// 23-bit noise generator for the hi-hat, snare and cymbal
+	int16_t zeroMod;		// Always 0 - operators with no modulator point here
+	uint8_t zeroTrem;		// Always 0 - operators with AM off point here
+	uint8_t rmHhBit2;
+	uint8_t rmHhBit3;
+	uint8_t rmHhBit7;
+	uint8_t rmHhBit8;
+	uint8_t rmTcBit3;
+	uint8_t rmTcBit5;
+	uint8_t idleSlots;		// How many operators were fully released last sample (36 = the whole chip is silent)
+	uint8_t skipSilence;	// Don't run the operators at all while the whole chip is silent
+	uint8_t quality;		// OPL_EMU_QUALITY_*
+	int16_t *stemOut;		// If set, each sample also writes OPL_EMU_STEMS stereo pairs here and moves along
+	uint8_t stemBase;		// First stem this chip's channels go in (9 for the second chip of a dual OPL2)
+	int16_t stemMask[2];	// Which sides of the stems this chip is heard on (a dual OPL2 is one chip per side)
+	uint32_t silentSamples;	// How many samples were skipped that way
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void oplEmuReset(oplEmuChip *chip, uint8_t chipType);			// Put a chip back in its power-on state
+void oplEmuWrite(oplEmuChip *chip, uint16_t reg, uint8_t data);	// Write a register, same numbering as writeOPL (0x100+ is the OPL3 second bank)
+void oplEmuGenerate(oplEmuChip *chip, int16_t *left, int16_t *right);	// Run the chip for one sample and return the left and right output
+void oplEmuGenerateBlock(oplEmuChip *chip, int16_t *left, int16_t *right, uint16_t frames);	// Run the chip for a run of samples into an interleaved stereo buffer
+void oplEmuSkipSilence(oplEmuChip *chip, uint16_t frames);		// Move a silent chip's timers along without running the operators
+void oplEmuStemOutput(oplEmuChip *chip);						// Write this sample's per-channel and drum outputs to stemOut
+
+// Internals
+void oplEmuEnvelopeUpdateKsl(oplEmuSlot *slot);					// Recalculate key scale level attenuation after a frequency change
+void oplEmuSlotUpdate(oplEmuSlot *slot);						// Recalculate the per-operator values the sample loop uses after a register write
+void oplEmuUpdateVibrato(oplEmuChip *chip);					// Recalculate the phase step of every operator with vibrato on after it moves or its depth changes
+uint32_t oplEmuVibratoInc(oplEmuSlot *slot);					// Phase step for an operator with vibrato on, at the current point in the vibrato
+void oplEmuClock(oplEmuChip *chip);								// Step the tremolo, vibrato and envelope timers at the end of a sample
+void oplEmuKeyOn(oplEmuSlot *slot, uint8_t type);
+void oplEmuKeyOff(oplEmuSlot *slot, uint8_t type);
+void oplEmuChannelSetupAlg(oplEmuChannel *channel);				// Point each operator at its modulator and the channel at its outputs
+void oplEmuChannelUpdateAlg(oplEmuChannel *channel);			// Work out the algorithm, taking 4-op pairs into account
+void oplEmuChannelKeyOn(oplEmuChannel *channel);
+void oplEmuChannelKeyOff(oplEmuChannel *channel);
+void oplEmuChannelUpdateFrequency(oplEmuChannel *channel);		// Recalculate KSV/KSL after an 0xA0/0xB0 write (and copy to the 4-op partner)
+void oplEmuSet4Op(oplEmuChip *chip, uint8_t data);				// 0x104 write
+void oplEmuUpdateRhythm(oplEmuChip *chip, uint8_t data);		// 0xBD write
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// These live in OPLTAB.C, which MKTABLES.EXE makes from the formulas at build time
+extern const uint16_t oplEmuExpTable[256];	// 2^x for the fractional part of the attenuation
+extern const uint16_t far oplEmuWaveTable[8][1024];	// All 8 waveforms in the log domain (from -log2(sin) in 4.8 fixed point), top bit set for the negative half
+
+#endif
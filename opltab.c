@@ -0,0 +1,559 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// OPLTAB.C - Emulator lookup tables
+//
+// Made by MKTABLES.EXE - change that and run it again instead of editing this.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "oplemu.h"
+
+const uint16_t oplEmuExpTable[256] = {
+	0x07FA,0x07F5,0x07EF,0x07EA,0x07E4,0x07DF,0x07DA,0x07D4,0x07CF,0x07C9,0x07C4,0x07BF,0x07B9,0x07B4,0x07AE,0x07A9,
+	0x07A4,0x079F,0x0799,0x0794,0x078F,0x078A,0x0784,0x077F,0x077A,0x0775,0x0770,0x076A,0x0765,0x0760,0x075B,0x0756,
+	0x0751,0x074C,0x0747,0x0742,0x073D,0x0738,0x0733,0x072E,0x0729,0x0724,0x071F,0x071A,0x0715,0x0710,0x070B,0x0706,
+	0x0702,0x06FD,0x06F8,0x06F3,0x06EE,0x06E9,0x06E5,0x06E0,0x06DB,0x06D6,0x06D2,0x06CD,0x06C8,0x06C4,0x06BF,0x06BA,
+	0x06B5,0x06B1,0x06AC,0x06A8,0x06A3,0x069E,0x069A,0x0695,0x0691,0x068C,0x0688,0x0683,0x067F,0x067A,0x0676,0x0671,
+	0x066D,0x0668,0x0664,0x065F,0x065B,0x0657,0x0652,0x064E,0x0649,0x0645,0x0641,0x063C,0x0638,0x0634,0x0630,0x062B,
+	0x0627,0x0623,0x061E,0x061A,0x0616,0x0612,0x060E,0x0609,0x0605,0x0601,0x05FD,0x05F9,0x05F5,0x05F0,0x05EC,0x05E8,
+	0x05E4,0x05E0,0x05DC,0x05D8,0x05D4,0x05D0,0x05CC,0x05C8,0x05C4,0x05C0,0x05BC,0x05B8,0x05B4,0x05B0,0x05AC,0x05A8,
+	0x05A4,0x05A0,0x059C,0x0599,0x0595,0x0591,0x058D,0x0589,0x0585,0x0581,0x057E,0x057A,0x0576,0x0572,0x056F,0x056B,
+	0x0567,0x0563,0x0560,0x055C,0x0558,0x0554,0x0551,0x054D,0x0549,0x0546,0x0542,0x053E,0x053B,0x0537,0x0534,0x0530,
+	0x052C,0x0529,0x0525,0x0522,0x051E,0x051B,0x0517,0x0514,0x0510,0x050C,0x0509,0x0506,0x0502,0x04FF,0x04FB,0x04F8,
+	0x04F4,0x04F1,0x04ED,0x04EA,0x04E7,0x04E3,0x04E0,0x04DC,0x04D9,0x04D6,0x04D2,0x04CF,0x04CC,0x04C8,0x04C5,0x04C2,
+	0x04BE,0x04BB,0x04B8,0x04B5,0x04B1,0x04AE,0x04AB,0x04A8,0x04A4,0x04A1,0x049E,0x049B,0x0498,0x0494,0x0491,0x048E,
+	0x048B,0x0488,0x0485,0x0482,0x047E,0x047B,0x0478,0x0475,0x0472,0x046F,0x046C,0x0469,0x0466,0x0463,0x0460,0x045D,
+	0x045A,0x0457,0x0454,0x0451,0x044E,0x044B,0x0448,0x0445,0x0442,0x043F,0x043C,0x0439,0x0436,0x0433,0x0430,0x042D,
+	0x042A,0x0428,0x0425,0x0422,0x041F,0x041C,0x0419,0x0416,0x0414,0x0411,0x040E,0x040B,0x0408,0x0406,0x0403,0x0400
+};
+
+const uint16_t far oplEmuWaveTable[8][1024] = {
+{
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,
+	0x0002,0x0002,0x0002,0x0003,0x0003,0x0003,0x0004,0x0004,0x0004,0x0005,0x0005,0x0005,0x0006,0x0006,0x0007,0x0007,
+	0x0007,0x0008,0x0008,0x0009,0x0009,0x000A,0x000A,0x000B,0x000C,0x000C,0x000D,0x000D,0x000E,0x000F,0x000F,0x0010,
+	0x0011,0x0011,0x0012,0x0013,0x0014,0x0014,0x0015,0x0016,0x0017,0x0017,0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,
+	0x001E,0x001F,0x0020,0x0021,0x0022,0x0023,0x0024,0x0025,0x0026,0x0027,0x0028,0x0029,0x002A,0x002B,0x002D,0x002E,
+	0x002F,0x0030,0x0031,0x0033,0x0034,0x0035,0x0037,0x0038,0x0039,0x003B,0x003C,0x003E,0x003F,0x0040,0x0042,0x0043,
+	0x0045,0x0046,0x0048,0x004A,0x004B,0x004D,0x004E,0x0050,0x0052,0x0053,0x0055,0x0057,0x0059,0x005B,0x005C,0x005E,
+	0x0060,0x0062,0x0064,0x0066,0x0068,0x006A,0x006C,0x006E,0x0070,0x0072,0x0074,0x0076,0x0078,0x007A,0x007D,0x007F,
+	0x0081,0x0083,0x0086,0x0088,0x008A,0x008D,0x008F,0x0092,0x0094,0x0097,0x0099,0x009C,0x009F,0x00A1,0x00A4,0x00A7,
+	0x00A9,0x00AC,0x00AF,0x00B2,0x00B5,0x00B8,0x00BB,0x00BE,0x00C1,0x00C4,0x00C7,0x00CA,0x00CD,0x00D1,0x00D4,0x00D7,
+	0x00DB,0x00DE,0x00E2,0x00E5,0x00E9,0x00EC,0x00F0,0x00F4,0x00F8,0x00FB,0x00FF,0x0103,0x0107,0x010B,0x010F,0x0114,
+	0x0118,0x011C,0x0121,0x0125,0x0129,0x012E,0x0133,0x0137,0x013C,0x0141,0x0146,0x014B,0x0150,0x0155,0x015B,0x0160,
+	0x0166,0x016B,0x0171,0x0177,0x017C,0x0182,0x0188,0x018F,0x0195,0x019B,0x01A2,0x01A9,0x01B0,0x01B7,0x01BE,0x01C5,
+	0x01CD,0x01D4,0x01DC,0x01E4,0x01EC,0x01F5,0x01FD,0x0206,0x020F,0x0218,0x0222,0x022C,0x0236,0x0240,0x024B,0x0256,
+	0x0261,0x026D,0x0279,0x0286,0x0293,0x02A0,0x02AF,0x02BD,0x02CD,0x02DC,0x02ED,0x02FF,0x0311,0x0324,0x0339,0x034E,
+	0x0365,0x037E,0x0398,0x03B5,0x03D3,0x03F5,0x041A,0x0443,0x0471,0x04A6,0x04E4,0x052E,0x058B,0x0607,0x06C3,0x0859,
+	0x8859,0x86C3,0x8607,0x858B,0x852E,0x84E4,0x84A6,0x8471,0x8443,0x841A,0x83F5,0x83D3,0x83B5,0x8398,0x837E,0x8365,
+	0x834E,0x8339,0x8324,0x8311,0x82FF,0x82ED,0x82DC,0x82CD,0x82BD,0x82AF,0x82A0,0x8293,0x8286,0x8279,0x826D,0x8261,
+	0x8256,0x824B,0x8240,0x8236,0x822C,0x8222,0x8218,0x820F,0x8206,0x81FD,0x81F5,0x81EC,0x81E4,0x81DC,0x81D4,0x81CD,
+	0x81C5,0x81BE,0x81B7,0x81B0,0x81A9,0x81A2,0x819B,0x8195,0x818F,0x8188,0x8182,0x817C,0x8177,0x8171,0x816B,0x8166,
+	0x8160,0x815B,0x8155,0x8150,0x814B,0x8146,0x8141,0x813C,0x8137,0x8133,0x812E,0x8129,0x8125,0x8121,0x811C,0x8118,
+	0x8114,0x810F,0x810B,0x8107,0x8103,0x80FF,0x80FB,0x80F8,0x80F4,0x80F0,0x80EC,0x80E9,0x80E5,0x80E2,0x80DE,0x80DB,
+	0x80D7,0x80D4,0x80D1,0x80CD,0x80CA,0x80C7,0x80C4,0x80C1,0x80BE,0x80BB,0x80B8,0x80B5,0x80B2,0x80AF,0x80AC,0x80A9,
+	0x80A7,0x80A4,0x80A1,0x809F,0x809C,0x8099,0x8097,0x8094,0x8092,0x808F,0x808D,0x808A,0x8088,0x8086,0x8083,0x8081,
+	0x807F,0x807D,0x807A,0x8078,0x8076,0x8074,0x8072,0x8070,0x806E,0x806C,0x806A,0x8068,0x8066,0x8064,0x8062,0x8060,
+	0x805E,0x805C,0x805B,0x8059,0x8057,0x8055,0x8053,0x8052,0x8050,0x804E,0x804D,0x804B,0x804A,0x8048,0x8046,0x8045,
+	0x8043,0x8042,0x8040,0x803F,0x803E,0x803C,0x803B,0x8039,0x8038,0x8037,0x8035,0x8034,0x8033,0x8031,0x8030,0x802F,
+	0x802E,0x802D,0x802B,0x802A,0x8029,0x8028,0x8027,0x8026,0x8025,0x8024,0x8023,0x8022,0x8021,0x8020,0x801F,0x801E,
+	0x801D,0x801C,0x801B,0x801A,0x8019,0x8018,0x8017,0x8017,0x8016,0x8015,0x8014,0x8014,0x8013,0x8012,0x8011,0x8011,
+	0x8010,0x800F,0x800F,0x800E,0x800D,0x800D,0x800C,0x800C,0x800B,0x800A,0x800A,0x8009,0x8009,0x8008,0x8008,0x8007,
+	0x8007,0x8007,0x8006,0x8006,0x8005,0x8005,0x8005,0x8004,0x8004,0x8004,0x8003,0x8003,0x8003,0x8002,0x8002,0x8002,
+	0x8002,0x8001,0x8001,0x8001,0x8001,0x8001,0x8001,0x8001,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8001,0x8001,0x8001,0x8001,0x8001,0x8001,0x8001,0x8002,
+	0x8002,0x8002,0x8002,0x8003,0x8003,0x8003,0x8004,0x8004,0x8004,0x8005,0x8005,0x8005,0x8006,0x8006,0x8007,0x8007,
+	0x8007,0x8008,0x8008,0x8009,0x8009,0x800A,0x800A,0x800B,0x800C,0x800C,0x800D,0x800D,0x800E,0x800F,0x800F,0x8010,
+	0x8011,0x8011,0x8012,0x8013,0x8014,0x8014,0x8015,0x8016,0x8017,0x8017,0x8018,0x8019,0x801A,0x801B,0x801C,0x801D,
+	0x801E,0x801F,0x8020,0x8021,0x8022,0x8023,0x8024,0x8025,0x8026,0x8027,0x8028,0x8029,0x802A,0x802B,0x802D,0x802E,
+	0x802F,0x8030,0x8031,0x8033,0x8034,0x8035,0x8037,0x8038,0x8039,0x803B,0x803C,0x803E,0x803F,0x8040,0x8042,0x8043,
+	0x8045,0x8046,0x8048,0x804A,0x804B,0x804D,0x804E,0x8050,0x8052,0x8053,0x8055,0x8057,0x8059,0x805B,0x805C,0x805E,
+	0x8060,0x8062,0x8064,0x8066,0x8068,0x806A,0x806C,0x806E,0x8070,0x8072,0x8074,0x8076,0x8078,0x807A,0x807D,0x807F,
+	0x8081,0x8083,0x8086,0x8088,0x808A,0x808D,0x808F,0x8092,0x8094,0x8097,0x8099,0x809C,0x809F,0x80A1,0x80A4,0x80A7,
+	0x80A9,0x80AC,0x80AF,0x80B2,0x80B5,0x80B8,0x80BB,0x80BE,0x80C1,0x80C4,0x80C7,0x80CA,0x80CD,0x80D1,0x80D4,0x80D7,
+	0x80DB,0x80DE,0x80E2,0x80E5,0x80E9,0x80EC,0x80F0,0x80F4,0x80F8,0x80FB,0x80FF,0x8103,0x8107,0x810B,0x810F,0x8114,
+	0x8118,0x811C,0x8121,0x8125,0x8129,0x812E,0x8133,0x8137,0x813C,0x8141,0x8146,0x814B,0x8150,0x8155,0x815B,0x8160,
+	0x8166,0x816B,0x8171,0x8177,0x817C,0x8182,0x8188,0x818F,0x8195,0x819B,0x81A2,0x81A9,0x81B0,0x81B7,0x81BE,0x81C5,
+	0x81CD,0x81D4,0x81DC,0x81E4,0x81EC,0x81F5,0x81FD,0x8206,0x820F,0x8218,0x8222,0x822C,0x8236,0x8240,0x824B,0x8256,
+	0x8261,0x826D,0x8279,0x8286,0x8293,0x82A0,0x82AF,0x82BD,0x82CD,0x82DC,0x82ED,0x82FF,0x8311,0x8324,0x8339,0x834E,
+	0x8365,0x837E,0x8398,0x83B5,0x83D3,0x83F5,0x841A,0x8443,0x8471,0x84A6,0x84E4,0x852E,0x858B,0x8607,0x86C3,0x8859
+},
+{
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,
+	0x0002,0x0002,0x0002,0x0003,0x0003,0x0003,0x0004,0x0004,0x0004,0x0005,0x0005,0x0005,0x0006,0x0006,0x0007,0x0007,
+	0x0007,0x0008,0x0008,0x0009,0x0009,0x000A,0x000A,0x000B,0x000C,0x000C,0x000D,0x000D,0x000E,0x000F,0x000F,0x0010,
+	0x0011,0x0011,0x0012,0x0013,0x0014,0x0014,0x0015,0x0016,0x0017,0x0017,0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,
+	0x001E,0x001F,0x0020,0x0021,0x0022,0x0023,0x0024,0x0025,0x0026,0x0027,0x0028,0x0029,0x002A,0x002B,0x002D,0x002E,
+	0x002F,0x0030,0x0031,0x0033,0x0034,0x0035,0x0037,0x0038,0x0039,0x003B,0x003C,0x003E,0x003F,0x0040,0x0042,0x0043,
+	0x0045,0x0046,0x0048,0x004A,0x004B,0x004D,0x004E,0x0050,0x0052,0x0053,0x0055,0x0057,0x0059,0x005B,0x005C,0x005E,
+	0x0060,0x0062,0x0064,0x0066,0x0068,0x006A,0x006C,0x006E,0x0070,0x0072,0x0074,0x0076,0x0078,0x007A,0x007D,0x007F,
+	0x0081,0x0083,0x0086,0x0088,0x008A,0x008D,0x008F,0x0092,0x0094,0x0097,0x0099,0x009C,0x009F,0x00A1,0x00A4,0x00A7,
+	0x00A9,0x00AC,0x00AF,0x00B2,0x00B5,0x00B8,0x00BB,0x00BE,0x00C1,0x00C4,0x00C7,0x00CA,0x00CD,0x00D1,0x00D4,0x00D7,
+	0x00DB,0x00DE,0x00E2,0x00E5,0x00E9,0x00EC,0x00F0,0x00F4,0x00F8,0x00FB,0x00FF,0x0103,0x0107,0x010B,0x010F,0x0114,
+	0x0118,0x011C,0x0121,0x0125,0x0129,0x012E,0x0133,0x0137,0x013C,0x0141,0x0146,0x014B,0x0150,0x0155,0x015B,0x0160,
+	0x0166,0x016B,0x0171,0x0177,0x017C,0x0182,0x0188,0x018F,0x0195,0x019B,0x01A2,0x01A9,0x01B0,0x01B7,0x01BE,0x01C5,
+	0x01CD,0x01D4,0x01DC,0x01E4,0x01EC,0x01F5,0x01FD,0x0206,0x020F,0x0218,0x0222,0x022C,0x0236,0x0240,0x024B,0x0256,
+	0x0261,0x026D,0x0279,0x0286,0x0293,0x02A0,0x02AF,0x02BD,0x02CD,0x02DC,0x02ED,0x02FF,0x0311,0x0324,0x0339,0x034E,
+	0x0365,0x037E,0x0398,0x03B5,0x03D3,0x03F5,0x041A,0x0443,0x0471,0x04A6,0x04E4,0x052E,0x058B,0x0607,0x06C3,0x0859,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000
+},
+{
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,
+	0x0002,0x0002,0x0002,0x0003,0x0003,0x0003,0x0004,0x0004,0x0004,0x0005,0x0005,0x0005,0x0006,0x0006,0x0007,0x0007,
+	0x0007,0x0008,0x0008,0x0009,0x0009,0x000A,0x000A,0x000B,0x000C,0x000C,0x000D,0x000D,0x000E,0x000F,0x000F,0x0010,
+	0x0011,0x0011,0x0012,0x0013,0x0014,0x0014,0x0015,0x0016,0x0017,0x0017,0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,
+	0x001E,0x001F,0x0020,0x0021,0x0022,0x0023,0x0024,0x0025,0x0026,0x0027,0x0028,0x0029,0x002A,0x002B,0x002D,0x002E,
+	0x002F,0x0030,0x0031,0x0033,0x0034,0x0035,0x0037,0x0038,0x0039,0x003B,0x003C,0x003E,0x003F,0x0040,0x0042,0x0043,
+	0x0045,0x0046,0x0048,0x004A,0x004B,0x004D,0x004E,0x0050,0x0052,0x0053,0x0055,0x0057,0x0059,0x005B,0x005C,0x005E,
+	0x0060,0x0062,0x0064,0x0066,0x0068,0x006A,0x006C,0x006E,0x0070,0x0072,0x0074,0x0076,0x0078,0x007A,0x007D,0x007F,
+	0x0081,0x0083,0x0086,0x0088,0x008A,0x008D,0x008F,0x0092,0x0094,0x0097,0x0099,0x009C,0x009F,0x00A1,0x00A4,0x00A7,
+	0x00A9,0x00AC,0x00AF,0x00B2,0x00B5,0x00B8,0x00BB,0x00BE,0x00C1,0x00C4,0x00C7,0x00CA,0x00CD,0x00D1,0x00D4,0x00D7,
+	0x00DB,0x00DE,0x00E2,0x00E5,0x00E9,0x00EC,0x00F0,0x00F4,0x00F8,0x00FB,0x00FF,0x0103,0x0107,0x010B,0x010F,0x0114,
+	0x0118,0x011C,0x0121,0x0125,0x0129,0x012E,0x0133,0x0137,0x013C,0x0141,0x0146,0x014B,0x0150,0x0155,0x015B,0x0160,
+	0x0166,0x016B,0x0171,0x0177,0x017C,0x0182,0x0188,0x018F,0x0195,0x019B,0x01A2,0x01A9,0x01B0,0x01B7,0x01BE,0x01C5,
+	0x01CD,0x01D4,0x01DC,0x01E4,0x01EC,0x01F5,0x01FD,0x0206,0x020F,0x0218,0x0222,0x022C,0x0236,0x0240,0x024B,0x0256,
+	0x0261,0x026D,0x0279,0x0286,0x0293,0x02A0,0x02AF,0x02BD,0x02CD,0x02DC,0x02ED,0x02FF,0x0311,0x0324,0x0339,0x034E,
+	0x0365,0x037E,0x0398,0x03B5,0x03D3,0x03F5,0x041A,0x0443,0x0471,0x04A6,0x04E4,0x052E,0x058B,0x0607,0x06C3,0x0859,
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0002,
+	0x0002,0x0002,0x0002,0x0003,0x0003,0x0003,0x0004,0x0004,0x0004,0x0005,0x0005,0x0005,0x0006,0x0006,0x0007,0x0007,
+	0x0007,0x0008,0x0008,0x0009,0x0009,0x000A,0x000A,0x000B,0x000C,0x000C,0x000D,0x000D,0x000E,0x000F,0x000F,0x0010,
+	0x0011,0x0011,0x0012,0x0013,0x0014,0x0014,0x0015,0x0016,0x0017,0x0017,0x0018,0x0019,0x001A,0x001B,0x001C,0x001D,
+	0x001E,0x001F,0x0020,0x0021,0x0022,0x0023,0x0024,0x0025,0x0026,0x0027,0x0028,0x0029,0x002A,0x002B,0x002D,0x002E,
+	0x002F,0x0030,0x0031,0x0033,0x0034,0x0035,0x0037,0x0038,0x0039,0x003B,0x003C,0x003E,0x003F,0x0040,0x0042,0x0043,
+	0x0045,0x0046,0x0048,0x004A,0x004B,0x004D,0x004E,0x0050,0x0052,0x0053,0x0055,0x0057,0x0059,0x005B,0x005C,0x005E,
+	0x0060,0x0062,0x0064,0x0066,0x0068,0x006A,0x006C,0x006E,0x0070,0x0072,0x0074,0x0076,0x0078,0x007A,0x007D,0x007F,
+	0x0081,0x0083,0x0086,0x0088,0x008A,0x008D,0x008F,0x0092,0x0094,0x0097,0x0099,0x009C,0x009F,0x00A1,0x00A4,0x00A7,
+	0x00A9,0x00AC,0x00AF,0x00B2,0x00B5,0x00B8,0x00BB,0x00BE,0x00C1,0x00C4,0x00C7,0x00CA,0x00CD,0x00D1,0x00D4,0x00D7,
+	0x00DB,0x00DE,0x00E2,0x00E5,0x00E9,0x00EC,0x00F0,0x00F4,0x00F8,0x00FB,0x00FF,0x0103,0x0107,0x010B,0x010F,0x0114,
+	0x0118,0x011C,0x0121,0x0125,0x0129,0x012E,0x0133,0x0137,0x013C,0x0141,0x0146,0x014B,0x0150,0x0155,0x015B,0x0160,
+	0x0166,0x016B,0x0171,0x0177,0x017C,0x0182,0x0188,0x018F,0x0195,0x019B,0x01A2,0x01A9,0x01B0,0x01B7,0x01BE,0x01C5,
+	0x01CD,0x01D4,0x01DC,0x01E4,0x01EC,0x01F5,0x01FD,0x0206,0x020F,0x0218,0x0222,0x022C,0x0236,0x0240,0x024B,0x0256,
+	0x0261,0x026D,0x0279,0x0286,0x0293,0x02A0,0x02AF,0x02BD,0x02CD,0x02DC,0x02ED,0x02FF,0x0311,0x0324,0x0339,0x034E,
+	0x0365,0x037E,0x0398,0x03B5,0x03D3,0x03F5,0x041A,0x0443,0x0471,0x04A6,0x04E4,0x052E,0x058B,0x0607,0x06C3,0x0859
+},
+{
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x0859,0x06C3,0x0607,0x058B,0x052E,0x04E4,0x04A6,0x0471,0x0443,0x041A,0x03F5,0x03D3,0x03B5,0x0398,0x037E,0x0365,
+	0x034E,0x0339,0x0324,0x0311,0x02FF,0x02ED,0x02DC,0x02CD,0x02BD,0x02AF,0x02A0,0x0293,0x0286,0x0279,0x026D,0x0261,
+	0x0256,0x024B,0x0240,0x0236,0x022C,0x0222,0x0218,0x020F,0x0206,0x01FD,0x01F5,0x01EC,0x01E4,0x01DC,0x01D4,0x01CD,
+	0x01C5,0x01BE,0x01B7,0x01B0,0x01A9,0x01A2,0x019B,0x0195,0x018F,0x0188,0x0182,0x017C,0x0177,0x0171,0x016B,0x0166,
+	0x0160,0x015B,0x0155,0x0150,0x014B,0x0146,0x0141,0x013C,0x0137,0x0133,0x012E,0x0129,0x0125,0x0121,0x011C,0x0118,
+	0x0114,0x010F,0x010B,0x0107,0x0103,0x00FF,0x00FB,0x00F8,0x00F4,0x00F0,0x00EC,0x00E9,0x00E5,0x00E2,0x00DE,0x00DB,
+	0x00D7,0x00D4,0x00D1,0x00CD,0x00CA,0x00C7,0x00C4,0x00C1,0x00BE,0x00BB,0x00B8,0x00B5,0x00B2,0x00AF,0x00AC,0x00A9,
+	0x00A7,0x00A4,0x00A1,0x009F,0x009C,0x0099,0x0097,0x0094,0x0092,0x008F,0x008D,0x008A,0x0088,0x0086,0x0083,0x0081,
+	0x007F,0x007D,0x007A,0x0078,0x0076,0x0074,0x0072,0x0070,0x006E,0x006C,0x006A,0x0068,0x0066,0x0064,0x0062,0x0060,
+	0x005E,0x005C,0x005B,0x0059,0x0057,0x0055,0x0053,0x0052,0x0050,0x004E,0x004D,0x004B,0x004A,0x0048,0x0046,0x0045,
+	0x0043,0x0042,0x0040,0x003F,0x003E,0x003C,0x003B,0x0039,0x0038,0x0037,0x0035,0x0034,0x0033,0x0031,0x0030,0x002F,
+	0x002E,0x002D,0x002B,0x002A,0x0029,0x0028,0x0027,0x0026,0x0025,0x0024,0x0023,0x0022,0x0021,0x0020,0x001F,0x001E,
+	0x001D,0x001C,0x001B,0x001A,0x0019,0x0018,0x0017,0x0017,0x0016,0x0015,0x0014,0x0014,0x0013,0x0012,0x0011,0x0011,
+	0x0010,0x000F,0x000F,0x000E,0x000D,0x000D,0x000C,0x000C,0x000B,0x000A,0x000A,0x0009,0x0009,0x0008,0x0008,0x0007,
+	0x0007,0x0007,0x0006,0x0006,0x0005,0x0005,0x0005,0x0004,0x0004,0x0004,0x0003,0x0003,0x0003,0x0002,0x0002,0x0002,
+	0x0002,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000
+},
+{
+	0x0859,0x0607,0x052E,0x04A6,0x0443,0x03F5,0x03B5,0x037E,0x034E,0x0324,0x02FF,0x02DC,0x02BD,0x02A0,0x0286,0x026D,
+	0x0256,0x0240,0x022C,0x0218,0x0206,0x01F5,0x01E4,0x01D4,0x01C5,0x01B7,0x01A9,0x019B,0x018F,0x0182,0x0177,0x016B,
+	0x0160,0x0155,0x014B,0x0141,0x0137,0x012E,0x0125,0x011C,0x0114,0x010B,0x0103,0x00FB,0x00F4,0x00EC,0x00E5,0x00DE,
+	0x00D7,0x00D1,0x00CA,0x00C4,0x00BE,0x00B8,0x00B2,0x00AC,0x00A7,0x00A1,0x009C,0x0097,0x0092,0x008D,0x0088,0x0083,
+	0x007F,0x007A,0x0076,0x0072,0x006E,0x006A,0x0066,0x0062,0x005E,0x005B,0x0057,0x0053,0x0050,0x004D,0x004A,0x0046,
+	0x0043,0x0040,0x003E,0x003B,0x0038,0x0035,0x0033,0x0030,0x002E,0x002B,0x0029,0x0027,0x0025,0x0023,0x0021,0x001F,
+	0x001D,0x001B,0x0019,0x0017,0x0016,0x0014,0x0013,0x0011,0x0010,0x000F,0x000D,0x000C,0x000B,0x000A,0x0009,0x0008,
+	0x0007,0x0006,0x0005,0x0005,0x0004,0x0003,0x0003,0x0002,0x0002,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0002,0x0002,0x0003,0x0003,0x0004,0x0005,0x0005,0x0006,0x0007,
+	0x0008,0x0009,0x000A,0x000B,0x000C,0x000D,0x000F,0x0010,0x0011,0x0013,0x0014,0x0016,0x0017,0x0019,0x001B,0x001D,
+	0x001F,0x0021,0x0023,0x0025,0x0027,0x0029,0x002B,0x002E,0x0030,0x0033,0x0035,0x0038,0x003B,0x003E,0x0040,0x0043,
+	0x0046,0x004A,0x004D,0x0050,0x0053,0x0057,0x005B,0x005E,0x0062,0x0066,0x006A,0x006E,0x0072,0x0076,0x007A,0x007F,
+	0x0083,0x0088,0x008D,0x0092,0x0097,0x009C,0x00A1,0x00A7,0x00AC,0x00B2,0x00B8,0x00BE,0x00C4,0x00CA,0x00D1,0x00D7,
+	0x00DE,0x00E5,0x00EC,0x00F4,0x00FB,0x0103,0x010B,0x0114,0x011C,0x0125,0x012E,0x0137,0x0141,0x014B,0x0155,0x0160,
+	0x016B,0x0177,0x0182,0x018F,0x019B,0x01A9,0x01B7,0x01C5,0x01D4,0x01E4,0x01F5,0x0206,0x0218,0x022C,0x0240,0x0256,
+	0x026D,0x0286,0x02A0,0x02BD,0x02DC,0x02FF,0x0324,0x034E,0x037E,0x03B5,0x03F5,0x0443,0x04A6,0x052E,0x0607,0x0859,
+	0x8859,0x8607,0x852E,0x84A6,0x8443,0x83F5,0x83B5,0x837E,0x834E,0x8324,0x82FF,0x82DC,0x82BD,0x82A0,0x8286,0x826D,
+	0x8256,0x8240,0x822C,0x8218,0x8206,0x81F5,0x81E4,0x81D4,0x81C5,0x81B7,0x81A9,0x819B,0x818F,0x8182,0x8177,0x816B,
+	0x8160,0x8155,0x814B,0x8141,0x8137,0x812E,0x8125,0x811C,0x8114,0x810B,0x8103,0x80FB,0x80F4,0x80EC,0x80E5,0x80DE,
+	0x80D7,0x80D1,0x80CA,0x80C4,0x80BE,0x80B8,0x80B2,0x80AC,0x80A7,0x80A1,0x809C,0x8097,0x8092,0x808D,0x8088,0x8083,
+	0x807F,0x807A,0x8076,0x8072,0x806E,0x806A,0x8066,0x8062,0x805E,0x805B,0x8057,0x8053,0x8050,0x804D,0x804A,0x8046,
+	0x8043,0x8040,0x803E,0x803B,0x8038,0x8035,0x8033,0x8030,0x802E,0x802B,0x8029,0x8027,0x8025,0x8023,0x8021,0x801F,
+	0x801D,0x801B,0x8019,0x8017,0x8016,0x8014,0x8013,0x8011,0x8010,0x800F,0x800D,0x800C,0x800B,0x800A,0x8009,0x8008,
+	0x8007,0x8006,0x8005,0x8005,0x8004,0x8003,0x8003,0x8002,0x8002,0x8001,0x8001,0x8001,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8001,0x8001,0x8001,0x8002,0x8002,0x8003,0x8003,0x8004,0x8005,0x8005,0x8006,0x8007,
+	0x8008,0x8009,0x800A,0x800B,0x800C,0x800D,0x800F,0x8010,0x8011,0x8013,0x8014,0x8016,0x8017,0x8019,0x801B,0x801D,
+	0x801F,0x8021,0x8023,0x8025,0x8027,0x8029,0x802B,0x802E,0x8030,0x8033,0x8035,0x8038,0x803B,0x803E,0x8040,0x8043,
+	0x8046,0x804A,0x804D,0x8050,0x8053,0x8057,0x805B,0x805E,0x8062,0x8066,0x806A,0x806E,0x8072,0x8076,0x807A,0x807F,
+	0x8083,0x8088,0x808D,0x8092,0x8097,0x809C,0x80A1,0x80A7,0x80AC,0x80B2,0x80B8,0x80BE,0x80C4,0x80CA,0x80D1,0x80D7,
+	0x80DE,0x80E5,0x80EC,0x80F4,0x80FB,0x8103,0x810B,0x8114,0x811C,0x8125,0x812E,0x8137,0x8141,0x814B,0x8155,0x8160,
+	0x816B,0x8177,0x8182,0x818F,0x819B,0x81A9,0x81B7,0x81C5,0x81D4,0x81E4,0x81F5,0x8206,0x8218,0x822C,0x8240,0x8256,
+	0x826D,0x8286,0x82A0,0x82BD,0x82DC,0x82FF,0x8324,0x834E,0x837E,0x83B5,0x83F5,0x8443,0x84A6,0x852E,0x8607,0x8859,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000
+},
+{
+	0x0859,0x0607,0x052E,0x04A6,0x0443,0x03F5,0x03B5,0x037E,0x034E,0x0324,0x02FF,0x02DC,0x02BD,0x02A0,0x0286,0x026D,
+	0x0256,0x0240,0x022C,0x0218,0x0206,0x01F5,0x01E4,0x01D4,0x01C5,0x01B7,0x01A9,0x019B,0x018F,0x0182,0x0177,0x016B,
+	0x0160,0x0155,0x014B,0x0141,0x0137,0x012E,0x0125,0x011C,0x0114,0x010B,0x0103,0x00FB,0x00F4,0x00EC,0x00E5,0x00DE,
+	0x00D7,0x00D1,0x00CA,0x00C4,0x00BE,0x00B8,0x00B2,0x00AC,0x00A7,0x00A1,0x009C,0x0097,0x0092,0x008D,0x0088,0x0083,
+	0x007F,0x007A,0x0076,0x0072,0x006E,0x006A,0x0066,0x0062,0x005E,0x005B,0x0057,0x0053,0x0050,0x004D,0x004A,0x0046,
+	0x0043,0x0040,0x003E,0x003B,0x0038,0x0035,0x0033,0x0030,0x002E,0x002B,0x0029,0x0027,0x0025,0x0023,0x0021,0x001F,
+	0x001D,0x001B,0x0019,0x0017,0x0016,0x0014,0x0013,0x0011,0x0010,0x000F,0x000D,0x000C,0x000B,0x000A,0x0009,0x0008,
+	0x0007,0x0006,0x0005,0x0005,0x0004,0x0003,0x0003,0x0002,0x0002,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0002,0x0002,0x0003,0x0003,0x0004,0x0005,0x0005,0x0006,0x0007,
+	0x0008,0x0009,0x000A,0x000B,0x000C,0x000D,0x000F,0x0010,0x0011,0x0013,0x0014,0x0016,0x0017,0x0019,0x001B,0x001D,
+	0x001F,0x0021,0x0023,0x0025,0x0027,0x0029,0x002B,0x002E,0x0030,0x0033,0x0035,0x0038,0x003B,0x003E,0x0040,0x0043,
+	0x0046,0x004A,0x004D,0x0050,0x0053,0x0057,0x005B,0x005E,0x0062,0x0066,0x006A,0x006E,0x0072,0x0076,0x007A,0x007F,
+	0x0083,0x0088,0x008D,0x0092,0x0097,0x009C,0x00A1,0x00A7,0x00AC,0x00B2,0x00B8,0x00BE,0x00C4,0x00CA,0x00D1,0x00D7,
+	0x00DE,0x00E5,0x00EC,0x00F4,0x00FB,0x0103,0x010B,0x0114,0x011C,0x0125,0x012E,0x0137,0x0141,0x014B,0x0155,0x0160,
+	0x016B,0x0177,0x0182,0x018F,0x019B,0x01A9,0x01B7,0x01C5,0x01D4,0x01E4,0x01F5,0x0206,0x0218,0x022C,0x0240,0x0256,
+	0x026D,0x0286,0x02A0,0x02BD,0x02DC,0x02FF,0x0324,0x034E,0x037E,0x03B5,0x03F5,0x0443,0x04A6,0x052E,0x0607,0x0859,
+	0x0859,0x0607,0x052E,0x04A6,0x0443,0x03F5,0x03B5,0x037E,0x034E,0x0324,0x02FF,0x02DC,0x02BD,0x02A0,0x0286,0x026D,
+	0x0256,0x0240,0x022C,0x0218,0x0206,0x01F5,0x01E4,0x01D4,0x01C5,0x01B7,0x01A9,0x019B,0x018F,0x0182,0x0177,0x016B,
+	0x0160,0x0155,0x014B,0x0141,0x0137,0x012E,0x0125,0x011C,0x0114,0x010B,0x0103,0x00FB,0x00F4,0x00EC,0x00E5,0x00DE,
+	0x00D7,0x00D1,0x00CA,0x00C4,0x00BE,0x00B8,0x00B2,0x00AC,0x00A7,0x00A1,0x009C,0x0097,0x0092,0x008D,0x0088,0x0083,
+	0x007F,0x007A,0x0076,0x0072,0x006E,0x006A,0x0066,0x0062,0x005E,0x005B,0x0057,0x0053,0x0050,0x004D,0x004A,0x0046,
+	0x0043,0x0040,0x003E,0x003B,0x0038,0x0035,0x0033,0x0030,0x002E,0x002B,0x0029,0x0027,0x0025,0x0023,0x0021,0x001F,
+	0x001D,0x001B,0x0019,0x0017,0x0016,0x0014,0x0013,0x0011,0x0010,0x000F,0x000D,0x000C,0x000B,0x000A,0x0009,0x0008,
+	0x0007,0x0006,0x0005,0x0005,0x0004,0x0003,0x0003,0x0002,0x0002,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0002,0x0002,0x0003,0x0003,0x0004,0x0005,0x0005,0x0006,0x0007,
+	0x0008,0x0009,0x000A,0x000B,0x000C,0x000D,0x000F,0x0010,0x0011,0x0013,0x0014,0x0016,0x0017,0x0019,0x001B,0x001D,
+	0x001F,0x0021,0x0023,0x0025,0x0027,0x0029,0x002B,0x002E,0x0030,0x0033,0x0035,0x0038,0x003B,0x003E,0x0040,0x0043,
+	0x0046,0x004A,0x004D,0x0050,0x0053,0x0057,0x005B,0x005E,0x0062,0x0066,0x006A,0x006E,0x0072,0x0076,0x007A,0x007F,
+	0x0083,0x0088,0x008D,0x0092,0x0097,0x009C,0x00A1,0x00A7,0x00AC,0x00B2,0x00B8,0x00BE,0x00C4,0x00CA,0x00D1,0x00D7,
+	0x00DE,0x00E5,0x00EC,0x00F4,0x00FB,0x0103,0x010B,0x0114,0x011C,0x0125,0x012E,0x0137,0x0141,0x014B,0x0155,0x0160,
+	0x016B,0x0177,0x0182,0x018F,0x019B,0x01A9,0x01B7,0x01C5,0x01D4,0x01E4,0x01F5,0x0206,0x0218,0x022C,0x0240,0x0256,
+	0x026D,0x0286,0x02A0,0x02BD,0x02DC,0x02FF,0x0324,0x034E,0x037E,0x03B5,0x03F5,0x0443,0x04A6,0x052E,0x0607,0x0859,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,
+	0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000,0x1000
+},
+{
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,
+	0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000,0x8000
+},
+{
+	0x0000,0x0008,0x0010,0x0018,0x0020,0x0028,0x0030,0x0038,0x0040,0x0048,0x0050,0x0058,0x0060,0x0068,0x0070,0x0078,
+	0x0080,0x0088,0x0090,0x0098,0x00A0,0x00A8,0x00B0,0x00B8,0x00C0,0x00C8,0x00D0,0x00D8,0x00E0,0x00E8,0x00F0,0x00F8,
+	0x0100,0x0108,0x0110,0x0118,0x0120,0x0128,0x0130,0x0138,0x0140,0x0148,0x0150,0x0158,0x0160,0x0168,0x0170,0x0178,
+	0x0180,0x0188,0x0190,0x0198,0x01A0,0x01A8,0x01B0,0x01B8,0x01C0,0x01C8,0x01D0,0x01D8,0x01E0,0x01E8,0x01F0,0x01F8,
+	0x0200,0x0208,0x0210,0x0218,0x0220,0x0228,0x0230,0x0238,0x0240,0x0248,0x0250,0x0258,0x0260,0x0268,0x0270,0x0278,
+	0x0280,0x0288,0x0290,0x0298,0x02A0,0x02A8,0x02B0,0x02B8,0x02C0,0x02C8,0x02D0,0x02D8,0x02E0,0x02E8,0x02F0,0x02F8,
+	0x0300,0x0308,0x0310,0x0318,0x0320,0x0328,0x0330,0x0338,0x0340,0x0348,0x0350,0x0358,0x0360,0x0368,0x0370,0x0378,
+	0x0380,0x0388,0x0390,0x0398,0x03A0,0x03A8,0x03B0,0x03B8,0x03C0,0x03C8,0x03D0,0x03D8,0x03E0,0x03E8,0x03F0,0x03F8,
+	0x0400,0x0408,0x0410,0x0418,0x0420,0x0428,0x0430,0x0438,0x0440,0x0448,0x0450,0x0458,0x0460,0x0468,0x0470,0x0478,
+	0x0480,0x0488,0x0490,0x0498,0x04A0,0x04A8,0x04B0,0x04B8,0x04C0,0x04C8,0x04D0,0x04D8,0x04E0,0x04E8,0x04F0,0x04F8,
+	0x0500,0x0508,0x0510,0x0518,0x0520,0x0528,0x0530,0x0538,0x0540,0x0548,0x0550,0x0558,0x0560,0x0568,0x0570,0x0578,
+	0x0580,0x0588,0x0590,0x0598,0x05A0,0x05A8,0x05B0,0x05B8,0x05C0,0x05C8,0x05D0,0x05D8,0x05E0,0x05E8,0x05F0,0x05F8,
+	0x0600,0x0608,0x0610,0x0618,0x0620,0x0628,0x0630,0x0638,0x0640,0x0648,0x0650,0x0658,0x0660,0x0668,0x0670,0x0678,
+	0x0680,0x0688,0x0690,0x0698,0x06A0,0x06A8,0x06B0,0x06B8,0x06C0,0x06C8,0x06D0,0x06D8,0x06E0,0x06E8,0x06F0,0x06F8,
+	0x0700,0x0708,0x0710,0x0718,0x0720,0x0728,0x0730,0x0738,0x0740,0x0748,0x0750,0x0758,0x0760,0x0768,0x0770,0x0778,
+	0x0780,0x0788,0x0790,0x0798,0x07A0,0x07A8,0x07B0,0x07B8,0x07C0,0x07C8,0x07D0,0x07D8,0x07E0,0x07E8,0x07F0,0x07F8,
+	0x0800,0x0808,0x0810,0x0818,0x0820,0x0828,0x0830,0x0838,0x0840,0x0848,0x0850,0x0858,0x0860,0x0868,0x0870,0x0878,
+	0x0880,0x0888,0x0890,0x0898,0x08A0,0x08A8,0x08B0,0x08B8,0x08C0,0x08C8,0x08D0,0x08D8,0x08E0,0x08E8,0x08F0,0x08F8,
+	0x0900,0x0908,0x0910,0x0918,0x0920,0x0928,0x0930,0x0938,0x0940,0x0948,0x0950,0x0958,0x0960,0x0968,0x0970,0x0978,
+	0x0980,0x0988,0x0990,0x0998,0x09A0,0x09A8,0x09B0,0x09B8,0x09C0,0x09C8,0x09D0,0x09D8,0x09E0,0x09E8,0x09F0,0x09F8,
+	0x0A00,0x0A08,0x0A10,0x0A18,0x0A20,0x0A28,0x0A30,0x0A38,0x0A40,0x0A48,0x0A50,0x0A58,0x0A60,0x0A68,0x0A70,0x0A78,
+	0x0A80,0x0A88,0x0A90,0x0A98,0x0AA0,0x0AA8,0x0AB0,0x0AB8,0x0AC0,0x0AC8,0x0AD0,0x0AD8,0x0AE0,0x0AE8,0x0AF0,0x0AF8,
+	0x0B00,0x0B08,0x0B10,0x0B18,0x0B20,0x0B28,0x0B30,0x0B38,0x0B40,0x0B48,0x0B50,0x0B58,0x0B60,0x0B68,0x0B70,0x0B78,
+	0x0B80,0x0B88,0x0B90,0x0B98,0x0BA0,0x0BA8,0x0BB0,0x0BB8,0x0BC0,0x0BC8,0x0BD0,0x0BD8,0x0BE0,0x0BE8,0x0BF0,0x0BF8,
+	0x0C00,0x0C08,0x0C10,0x0C18,0x0C20,0x0C28,0x0C30,0x0C38,0x0C40,0x0C48,0x0C50,0x0C58,0x0C60,0x0C68,0x0C70,0x0C78,
+	0x0C80,0x0C88,0x0C90,0x0C98,0x0CA0,0x0CA8,0x0CB0,0x0CB8,0x0CC0,0x0CC8,0x0CD0,0x0CD8,0x0CE0,0x0CE8,0x0CF0,0x0CF8,
+	0x0D00,0x0D08,0x0D10,0x0D18,0x0D20,0x0D28,0x0D30,0x0D38,0x0D40,0x0D48,0x0D50,0x0D58,0x0D60,0x0D68,0x0D70,0x0D78,
+	0x0D80,0x0D88,0x0D90,0x0D98,0x0DA0,0x0DA8,0x0DB0,0x0DB8,0x0DC0,0x0DC8,0x0DD0,0x0DD8,0x0DE0,0x0DE8,0x0DF0,0x0DF8,
+	0x0E00,0x0E08,0x0E10,0x0E18,0x0E20,0x0E28,0x0E30,0x0E38,0x0E40,0x0E48,0x0E50,0x0E58,0x0E60,0x0E68,0x0E70,0x0E78,
+	0x0E80,0x0E88,0x0E90,0x0E98,0x0EA0,0x0EA8,0x0EB0,0x0EB8,0x0EC0,0x0EC8,0x0ED0,0x0ED8,0x0EE0,0x0EE8,0x0EF0,0x0EF8,
+	0x0F00,0x0F08,0x0F10,0x0F18,0x0F20,0x0F28,0x0F30,0x0F38,0x0F40,0x0F48,0x0F50,0x0F58,0x0F60,0x0F68,0x0F70,0x0F78,
+	0x0F80,0x0F88,0x0F90,0x0F98,0x0FA0,0x0FA8,0x0FB0,0x0FB8,0x0FC0,0x0FC8,0x0FD0,0x0FD8,0x0FE0,0x0FE8,0x0FF0,0x0FF8,
+	0x8FF8,0x8FF0,0x8FE8,0x8FE0,0x8FD8,0x8FD0,0x8FC8,0x8FC0,0x8FB8,0x8FB0,0x8FA8,0x8FA0,0x8F98,0x8F90,0x8F88,0x8F80,
+	0x8F78,0x8F70,0x8F68,0x8F60,0x8F58,0x8F50,0x8F48,0x8F40,0x8F38,0x8F30,0x8F28,0x8F20,0x8F18,0x8F10,0x8F08,0x8F00,
+	0x8EF8,0x8EF0,0x8EE8,0x8EE0,0x8ED8,0x8ED0,0x8EC8,0x8EC0,0x8EB8,0x8EB0,0x8EA8,0x8EA0,0x8E98,0x8E90,0x8E88,0x8E80,
+	0x8E78,0x8E70,0x8E68,0x8E60,0x8E58,0x8E50,0x8E48,0x8E40,0x8E38,0x8E30,0x8E28,0x8E20,0x8E18,0x8E10,0x8E08,0x8E00,
+	0x8DF8,0x8DF0,0x8DE8,0x8DE0,0x8DD8,0x8DD0,0x8DC8,0x8DC0,0x8DB8,0x8DB0,0x8DA8,0x8DA0,0x8D98,0x8D90,0x8D88,0x8D80,
+	0x8D78,0x8D70,0x8D68,0x8D60,0x8D58,0x8D50,0x8D48,0x8D40,0x8D38,0x8D30,0x8D28,0x8D20,0x8D18,0x8D10,0x8D08,0x8D00,
+	0x8CF8,0x8CF0,0x8CE8,0x8CE0,0x8CD8,0x8CD0,0x8CC8,0x8CC0,0x8CB8,0x8CB0,0x8CA8,0x8CA0,0x8C98,0x8C90,0x8C88,0x8C80,
+	0x8C78,0x8C70,0x8C68,0x8C60,0x8C58,0x8C50,0x8C48,0x8C40,0x8C38,0x8C30,0x8C28,0x8C20,0x8C18,0x8C10,0x8C08,0x8C00,
+	0x8BF8,0x8BF0,0x8BE8,0x8BE0,0x8BD8,0x8BD0,0x8BC8,0x8BC0,0x8BB8,0x8BB0,0x8BA8,0x8BA0,0x8B98,0x8B90,0x8B88,0x8B80,
+	0x8B78,0x8B70,0x8B68,0x8B60,0x8B58,0x8B50,0x8B48,0x8B40,0x8B38,0x8B30,0x8B28,0x8B20,0x8B18,0x8B10,0x8B08,0x8B00,
+	0x8AF8,0x8AF0,0x8AE8,0x8AE0,0x8AD8,0x8AD0,0x8AC8,0x8AC0,0x8AB8,0x8AB0,0x8AA8,0x8AA0,0x8A98,0x8A90,0x8A88,0x8A80,
+	0x8A78,0x8A70,0x8A68,0x8A60,0x8A58,0x8A50,0x8A48,0x8A40,0x8A38,0x8A30,0x8A28,0x8A20,0x8A18,0x8A10,0x8A08,0x8A00,
+	0x89F8,0x89F0,0x89E8,0x89E0,0x89D8,0x89D0,0x89C8,0x89C0,0x89B8,0x89B0,0x89A8,0x89A0,0x8998,0x8990,0x8988,0x8980,
+	0x8978,0x8970,0x8968,0x8960,0x8958,0x8950,0x8948,0x8940,0x8938,0x8930,0x8928,0x8920,0x8918,0x8910,0x8908,0x8900,
+	0x88F8,0x88F0,0x88E8,0x88E0,0x88D8,0x88D0,0x88C8,0x88C0,0x88B8,0x88B0,0x88A8,0x88A0,0x8898,0x8890,0x8888,0x8880,
+	0x8878,0x8870,0x8868,0x8860,0x8858,0x8850,0x8848,0x8840,0x8838,0x8830,0x8828,0x8820,0x8818,0x8810,0x8808,0x8800,
+	0x87F8,0x87F0,0x87E8,0x87E0,0x87D8,0x87D0,0x87C8,0x87C0,0x87B8,0x87B0,0x87A8,0x87A0,0x8798,0x8790,0x8788,0x8780,
+	0x8778,0x8770,0x8768,0x8760,0x8758,0x8750,0x8748,0x8740,0x8738,0x8730,0x8728,0x8720,0x8718,0x8710,0x8708,0x8700,
+	0x86F8,0x86F0,0x86E8,0x86E0,0x86D8,0x86D0,0x86C8,0x86C0,0x86B8,0x86B0,0x86A8,0x86A0,0x8698,0x8690,0x8688,0x8680,
+	0x8678,0x8670,0x8668,0x8660,0x8658,0x8650,0x8648,0x8640,0x8638,0x8630,0x8628,0x8620,0x8618,0x8610,0x8608,0x8600,
+	0x85F8,0x85F0,0x85E8,0x85E0,0x85D8,0x85D0,0x85C8,0x85C0,0x85B8,0x85B0,0x85A8,0x85A0,0x8598,0x8590,0x8588,0x8580,
+	0x8578,0x8570,0x8568,0x8560,0x8558,0x8550,0x8548,0x8540,0x8538,0x8530,0x8528,0x8520,0x8518,0x8510,0x8508,0x8500,
+	0x84F8,0x84F0,0x84E8,0x84E0,0x84D8,0x84D0,0x84C8,0x84C0,0x84B8,0x84B0,0x84A8,0x84A0,0x8498,0x8490,0x8488,0x8480,
+	0x8478,0x8470,0x8468,0x8460,0x8458,0x8450,0x8448,0x8440,0x8438,0x8430,0x8428,0x8420,0x8418,0x8410,0x8408,0x8400,
+	0x83F8,0x83F0,0x83E8,0x83E0,0x83D8,0x83D0,0x83C8,0x83C0,0x83B8,0x83B0,0x83A8,0x83A0,0x8398,0x8390,0x8388,0x8380,
+	0x8378,0x8370,0x8368,0x8360,0x8358,0x8350,0x8348,0x8340,0x8338,0x8330,0x8328,0x8320,0x8318,0x8310,0x8308,0x8300,
+	0x82F8,0x82F0,0x82E8,0x82E0,0x82D8,0x82D0,0x82C8,0x82C0,0x82B8,0x82B0,0x82A8,0x82A0,0x8298,0x8290,0x8288,0x8280,
+	0x8278,0x8270,0x8268,0x8260,0x8258,0x8250,0x8248,0x8240,0x8238,0x8230,0x8228,0x8220,0x8218,0x8210,0x8208,0x8200,
+	0x81F8,0x81F0,0x81E8,0x81E0,0x81D8,0x81D0,0x81C8,0x81C0,0x81B8,0x81B0,0x81A8,0x81A0,0x8198,0x8190,0x8188,0x8180,
+	0x8178,0x8170,0x8168,0x8160,0x8158,0x8150,0x8148,0x8140,0x8138,0x8130,0x8128,0x8120,0x8118,0x8110,0x8108,0x8100,
+	0x80F8,0x80F0,0x80E8,0x80E0,0x80D8,0x80D0,0x80C8,0x80C0,0x80B8,0x80B0,0x80A8,0x80A0,0x8098,0x8090,0x8088,0x8080,
+	0x8078,0x8070,0x8068,0x8060,0x8058,0x8050,0x8048,0x8040,0x8038,0x8030,0x8028,0x8020,0x8018,0x8010,0x8008,0x8000
+}
+};
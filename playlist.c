@@ -58,6 +58,30 @@ void countPlaylistSongs(void)
 	}
 }
 
+uint8_t playlistDetect(void)
+{
+	uint8_t found = FALSE;
+
+	errno = 0;
+	initialFilePointer = fopen(fileName,"rb");
+	if (initialFilePointer == NULL)
+	{
+		killProgram(ERROR_FILE_MISSING);
+	}
+	fgets(playlistLineBuffer,sizeof(playlistLineBuffer),initialFilePointer);
+	// It's a playlist
+	if (strncmp(playlistLineBuffer,"#VGMLIST", 8) == 0)
+	{
+		found = TRUE;
+	}
+	
+	// Close "initial file", we're done with it
+	// At this point we've validated that it is in fact a file already
+	fclose(initialFilePointer);
+	initialFilePointer = NULL;
+	return found;
+}
+
 void playlistGet(uint32_t songNumber)
 {
 	uint32_t i = 0;
@@ -26,6 +26,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 void countPlaylistSongs(void); 			// Gets us a count for how many lines are in the playlist
+uint8_t playlistDetect(void);			// Check whether the file given on the command line is a playlist or a VGM
 void playlistGet(uint32_t songNumber);	// Get the filename on line "songNumber" of the playlist
 										// so we can show a number like (1/99) or something
 void playlistInit(void);				// If a playlist was detected, this sets up playlist mode
@@ -0,0 +1,678 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// RENDER.C - Render a VGM to a WAV file with the software emulator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "golden.h"
+#include "opl.h"
+#include "playlist.h"
+#include "render.h"
+#include "resample.h"
+#include "settings.h"
+#include "timer.h"
+#include "vgm.h"
+#include "vgmslap.h"
+#include "xlat.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t renderMode = FALSE;
+char* renderFileName;
+FILE *renderFilePointer;
+uint32_t renderFrames = 0;
+uint32_t renderOutFrames = 0;
+uint32_t renderOutRate = OPL_EMU_RATE;
+uint32_t renderBlocks = 0;
+int16_t renderBuffer[RENDER_BUFFER_FRAMES * 2];
+int16_t renderOutBuffer[(RENDER_BUFFER_FRAMES + 1) * 2];
+resampleState renderResampler;
+uint8_t renderCheck = FALSE;
+int16_t *renderCheckBuffer = NULL;
+uint32_t renderCheckDiffs = 0;
+uint16_t renderCheckMaxDiff = 0;
+double renderCheckSignal = 0;
+double renderCheckNoise = 0;
+uint8_t renderStems = FALSE;
+char* renderStemPrefix;
+int16_t *renderStemBuffer = NULL;
+resampleState *renderStemResamplers = NULL;
+FILE *renderStemFiles[OPL_EMU_STEMS];
+uint32_t renderStemFrames[OPL_EMU_STEMS];
+int16_t renderStemIn[RENDER_STEM_FRAMES * 2];
+int16_t renderStemOut[(RENDER_STEM_FRAMES + 1) * 2];
+const char *renderStemNames[OPL_EMU_STEMS] = {"CH01", "CH02", "CH03", "CH04", "CH05", "CH06", "CH07", "CH08", "CH09",
+	"CH10", "CH11", "CH12", "CH13", "CH14", "CH15", "CH16", "CH17", "CH18", "BD", "SD", "TOM", "CYM", "HH"};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void renderVGM(char* inFileName, char* outFileName)
+{
+	uint16_t bufferFrames = 0;
+	uint32_t clockStep = 0;		// Fraction of a VGM sample, in 1/49716ths
+	uint32_t vgmSample = 0;		// Where the virtual clock is, in 44100hz VGM samples
+	uint32_t fadeStart = 0;
+	uint32_t fadeLength = 0;
+	uint32_t fadeGain;
+	uint8_t fading = FALSE;
+	uint8_t fadeDone = FALSE;
+	uint8_t loopsWanted;
+	uint16_t blockFrames;		// How many samples can be generated before the next command is due
+	uint32_t blockStep;			// Virtual clock at the start of the block, so the fade can follow along
+	uint32_t blockSample;
+	uint32_t nextStep;
+	uint32_t nextSample;
+	uint16_t i;
+	uint16_t j;
+	uint16_t bufferLimit = RENDER_BUFFER_FRAMES;
+	clock_t startTime;
+	clock_t elapsed;
+	uint32_t audioTenths;
+	uint32_t elapsedTenths;
+
+	renderMode = TRUE;
+
+	// Nothing carries over from the last song in a playlist - the chip, the VGM and the loop count all start fresh below
+	loopMax = settings.loopCount;
+	renderFilePointer = NULL;
+	renderCheckDiffs = 0;
+	renderCheckMaxDiff = 0;
+	renderCheckSignal = 0;
+	renderCheckNoise = 0;
+
+	// Checking the shortcuts means running a second set of chips that doesn't take any, so they can be compared sample for sample
+	if (renderCheck == TRUE)
+	{
+		oplEmuReference = (oplEmuChip*)malloc(sizeof(oplEmuChip) * 2);
+		renderCheckBuffer = (int16_t*)malloc(sizeof(int16_t) * RENDER_BUFFER_FRAMES * 2);
+		if (oplEmuReference == NULL || renderCheckBuffer == NULL)
+		{
+			killProgram(ERROR_RENDER_NO_MEMORY);
+		}
+	}
+
+	// Stems are written a short block at a time so the buffer for all of them stays small
+	if (renderStems == TRUE)
+	{
+		renderStemBuffer = (int16_t*)malloc(sizeof(int16_t) * RENDER_STEM_FRAMES * OPL_EMU_STEMS * 2);
+		renderStemResamplers = (resampleState*)malloc(sizeof(resampleState) * OPL_EMU_STEMS);
+		if (renderStemBuffer == NULL || renderStemResamplers == NULL)
+		{
+			killProgram(ERROR_RENDER_NO_MEMORY);
+		}
+		bufferLimit = RENDER_STEM_FRAMES;
+		for (i = 0; i < OPL_EMU_STEMS; i++)
+		{
+			renderStemFiles[i] = NULL;
+			renderStemFrames[i] = 0;
+		}
+		// DOS only gives a program 20 file handles, and five of those are taken before we start
+		_grow_handles(OPL_EMU_STEMS + 10);
+	}
+
+	// Always render with the emulator.  If the user didn't pick a chip, go with the one that can play everything.
+	if (settings.emulator == 0)
+	{
+		settings.emulator = DETECTED_OPL3;
+	}
+	initOPLEmulator((OplDetectedType)settings.emulator);
+	if (renderStems == TRUE && detectedChip == DETECTED_DUAL_OPL2)
+	{
+		// Second chip's channels go in after the first's, and each chip only sounds on its own side
+		oplEmu[0].stemMask[1] = 0;
+		oplEmu[1].stemMask[0] = 0;
+		oplEmu[1].stemBase = 9;
+	}
+	// Two OPL3s have more channels than there are stems
+	if (renderStems == TRUE && detectedChip == DETECTED_DUAL_OPL3)
+	{
+		killProgram(ERROR_RENDER_STEMS_UNSUPPORTED);
+	}
+
+	// Same load steps as initPlayback, minus anything to do with the screen or the timer
+	vgmFileName = inFileName;
+	loadVGM();
+	resetOPL();
+	if (xlatOPL3Mode == TRUE)
+	{
+		writeOPL(0x105,0x01);
+	}
+	fseek(vgmFilePointer,currentVGMHeader.vgmDataOffset+0x34,SEEK_SET);
+	fileCursorLocation = currentVGMHeader.gd3Offset+0x34;
+
+	// Looping songs play one extra time through so the fade-out has something to fade
+	loopCount = 0;
+	loopsWanted = loopMax;
+	if (currentVGMHeader.loopOffset > 0 && loopMax < 255)
+	{
+		loopMax++;
+	}
+
+	// Convert to a normal sample rate on the way out, unless the chip's own rate was asked for
+	renderOutRate = OPL_EMU_RATE;
+	if (settings.outputRate != 0 && settings.outputRate < OPL_EMU_RATE)
+	{
+		renderOutRate = settings.outputRate;
+		resampleBuildFilter(OPL_EMU_RATE, renderOutRate, settings.resampleTaps);
+		resampleInit(&renderResampler, OPL_EMU_RATE, renderOutRate, settings.resampleTaps);
+		if (renderStems == TRUE)
+		{
+			for (i = 0; i < OPL_EMU_STEMS; i++)
+			{
+				resampleInit(&renderStemResamplers[i], OPL_EMU_RATE, renderOutRate, settings.resampleTaps);
+			}
+		}
+	}
+
+	// A check doesn't write anything out
+	if (renderCheck == TRUE)
+	{
+		printf("Checking %s...\n", inFileName);
+	}
+	// Neither does a golden check - the audio only goes into its CRC
+	else if (goldenActive == TRUE)
+	{
+		printf("Testing %s...\n", inFileName);
+	}
+	// Stem files get opened as each one first makes a sound, so there's no mix to write
+	else if (renderStems == TRUE)
+	{
+		printf("Rendering %s to %s*.WAV...\n", inFileName, renderStemPrefix);
+	}
+	else
+	{
+		errno = 0;
+		renderFileName = outFileName;
+		renderFilePointer = fopen(outFileName, "wb");
+		if (renderFilePointer == NULL)
+		{
+			killProgram(ERROR_RENDER_OUTPUT_FAILED);
+		}
+		// Sizes aren't known yet - the header gets written again at the end
+		renderWriteHeader(renderFilePointer, 0);
+		printf("Rendering %s to %s...\n", inFileName, outFileName);
+	}
+	startTime = clock();
+	programState = STATE_PLAYING;
+	renderFrames = 0;
+	renderOutFrames = 0;
+	renderBlocks = 0;
+
+	while (programState == STATE_PLAYING && fadeDone == FALSE)
+	{
+		// Move the virtual clock along by one emulator sample.  There are 44100 VGM samples for every 49716 chip samples.
+		clockStep += 44100;
+		if (clockStep >= OPL_EMU_RATE)
+		{
+			clockStep -= OPL_EMU_RATE;
+			vgmSample++;
+		}
+		// Exactly the same logic as playback - processCommands() sends everything due before tickCounter.
+		// Every write that lands on this sample goes out in this one call.
+		tickCounter = vgmSample + 1;
+		processCommands();
+
+		// Start fading once we've gone past the number of loops that were asked for
+		if (fading == FALSE && loopCount > loopsWanted)
+		{
+			fading = TRUE;
+			fadeStart = vgmSample;
+			fadeLength = currentVGMHeader.loopNumSamples;
+			if (fadeLength == 0 || fadeLength > RENDER_FADE_SAMPLES)
+			{
+				fadeLength = RENDER_FADE_SAMPLES;
+			}
+		}
+
+		// Nothing touches the chip again until the next command is due, so rather than coming back through here
+		// every sample, run the clock forward to just before it and do that whole stretch in one go.
+		// dataCurrentSample is where processCommands() stopped, which is the sample the next command lands on.
+		blockSample = vgmSample;
+		blockStep = clockStep;
+		blockFrames = 1;
+		if (programState == STATE_PLAYING)
+		{
+			while (bufferFrames + blockFrames < bufferLimit)
+			{
+				nextStep = clockStep + 44100;
+				nextSample = vgmSample;
+				if (nextStep >= OPL_EMU_RATE)
+				{
+					nextStep -= OPL_EMU_RATE;
+					nextSample++;
+				}
+				if (nextSample >= dataCurrentSample)
+				{
+					break;
+				}
+				clockStep = nextStep;
+				vgmSample = nextSample;
+				blockFrames++;
+			}
+		}
+		renderBlocks++;
+
+		if (renderStems == TRUE)
+		{
+			// Both chips of a dual OPL2 write into the same stems, so they start at the same spot
+			memset(&renderStemBuffer[bufferFrames * OPL_EMU_STEMS * 2], 0, sizeof(int16_t) * blockFrames * OPL_EMU_STEMS * 2);
+			oplEmu[0].stemOut = &renderStemBuffer[bufferFrames * OPL_EMU_STEMS * 2];
+			oplEmu[1].stemOut = oplEmu[0].stemOut;
+		}
+		generateOPLBlock(&renderBuffer[bufferFrames * 2], blockFrames);
+		if (renderCheck == TRUE)
+		{
+			renderCompareBlock(&renderBuffer[bufferFrames * 2], blockFrames);
+		}
+
+		if (fading == TRUE)
+		{
+			// The volume follows the VGM clock, so step back through the block one sample at a time
+			for (i = 0; i < blockFrames; i++)
+			{
+				if ((blockSample - fadeStart) >= fadeLength)
+				{
+					// Faded out - anything after this point in the block gets dropped
+					blockFrames = i;
+					fadeDone = TRUE;
+					break;
+				}
+				// 8.8 fixed point volume, dropping in a straight line to zero
+				fadeGain = 256 - (((blockSample - fadeStart) << 8) / fadeLength);
+				renderBuffer[(bufferFrames + i) * 2] = (int16_t)(((int32_t)renderBuffer[(bufferFrames + i) * 2] * (int32_t)fadeGain) >> 8);
+				renderBuffer[(bufferFrames + i) * 2 + 1] = (int16_t)(((int32_t)renderBuffer[(bufferFrames + i) * 2 + 1] * (int32_t)fadeGain) >> 8);
+				if (renderStems == TRUE)
+				{
+					for (j = (bufferFrames + i) * OPL_EMU_STEMS * 2; j < (bufferFrames + i + 1) * OPL_EMU_STEMS * 2; j++)
+					{
+						renderStemBuffer[j] = (int16_t)(((int32_t)renderStemBuffer[j] * (int32_t)fadeGain) >> 8);
+					}
+				}
+				blockStep += 44100;
+				if (blockStep >= OPL_EMU_RATE)
+				{
+					blockStep -= OPL_EMU_RATE;
+					blockSample++;
+				}
+			}
+		}
+
+		bufferFrames += blockFrames;
+		if (bufferFrames == bufferLimit)
+		{
+			renderWriteBlock(renderBuffer, bufferFrames);
+			renderWriteStems(bufferFrames);
+			renderFrames += bufferFrames;
+			bufferFrames = 0;
+		}
+	}
+	renderWriteBlock(renderBuffer, bufferFrames);
+	renderWriteStems(bufferFrames);
+	renderFrames += bufferFrames;
+	if (renderFilePointer != NULL)
+	{
+		// Now we know how big it is, fix up the header
+		fseek(renderFilePointer, 0, SEEK_SET);
+		renderWriteHeader(renderFilePointer, renderOutFrames * 4);
+		fclose(renderFilePointer);
+		renderFilePointer = NULL;
+	}
+	fclose(vgmFilePointer);
+	vgmFilePointer = NULL;
+	if (renderStems == TRUE)
+	{
+		j = 0;
+		for (i = 0; i < OPL_EMU_STEMS; i++)
+		{
+			if (renderStemFiles[i] != NULL)
+			{
+				fseek(renderStemFiles[i], 0, SEEK_SET);
+				renderWriteHeader(renderStemFiles[i], renderStemFrames[i] * 4);
+				fclose(renderStemFiles[i]);
+				renderStemFiles[i] = NULL;
+				j++;
+			}
+		}
+		oplEmu[0].stemOut = NULL;
+		oplEmu[1].stemOut = NULL;
+		free(renderStemBuffer);
+		renderStemBuffer = NULL;
+		free(renderStemResamplers);
+		renderStemResamplers = NULL;
+	}
+
+	// How fast was that?  Everything in tenths of a second so it stays in integer math.
+	elapsed = clock() - startTime;
+	audioTenths = (renderFrames / (OPL_EMU_RATE / 10));
+	elapsedTenths = ((uint32_t)elapsed * 10) / CLOCKS_PER_SEC;
+	printf("Rendered %lu.%lus of audio in %lu.%lus", audioTenths / 10, audioTenths % 10, elapsedTenths / 10, elapsedTenths % 10);
+	if (elapsedTenths > 0)
+	{
+		printf(" (%lux real-time, %lu samples/sec)", audioTenths / elapsedTenths, (renderFrames / elapsedTenths) * 10);
+	}
+	printf("\n");
+	// Fewer, longer blocks means less time spent going back and forth between the VGM and the emulator
+	if (renderBlocks > 0)
+	{
+		printf("%lu blocks, %lu samples per block on average\n", renderBlocks, renderFrames / renderBlocks);
+	}
+	printf("%lu samples skipped as silent\n", oplEmu[0].silentSamples + oplEmu[1].silentSamples);
+	if (renderStems == TRUE)
+	{
+		printf("%u stems written (channels and drums that never made a sound were left out)\n", j);
+	}
+	if (renderOutRate != OPL_EMU_RATE)
+	{
+		printf("Resampled to %luhz with a %u tap filter\n", renderOutRate, settings.resampleTaps);
+	}
+
+	if (renderCheck == TRUE)
+	{
+		// The only thing skipping silence changes is the -1s an idle operator puts out on the negative half of its wave.
+		// Fast quality will be further off, so say how far in a way that means something.
+		printf("%lu of %lu samples differ from the full emulator, by at most %u\n", renderCheckDiffs, renderFrames, renderCheckMaxDiff);
+		if (renderCheckNoise > 0 && renderCheckSignal > 0)
+		{
+			printf("Signal-to-noise ratio %.1fdB\n", 10.0 * log10(renderCheckSignal / renderCheckNoise));
+		}
+		free(renderCheckBuffer);
+		renderCheckBuffer = NULL;
+		free(oplEmuReference);
+		oplEmuReference = NULL;
+	}
+}
+
+void renderPlaylist(char* outPath)
+{
+	uint16_t track;
+	renderTrack *tracks;
+	uint32_t totalFrames = 0;
+	uint32_t totalTenths = 0;
+	uint32_t audioTenths;
+	char outFileName[PATH_MAX];
+	clock_t startTime;
+
+	countPlaylistSongs();
+	tracks = (renderTrack*)malloc(sizeof(renderTrack) * (playlistMax + 1));
+	if (tracks == NULL)
+	{
+		killProgram(ERROR_RENDER_NO_MEMORY);
+	}
+
+	// One song after another, each one loaded and rendered exactly like it was the only one.
+	// This is on purpose, rather than a player context per song that several could run side by side: DOS gives us one CPU
+	// and no threads, and the VGM reader, the emulator chips and the register map are the same globals playback uses.
+	// So instead renderVGM puts every one of those back to a fresh start before each song, and all a song leaves behind is its line in "tracks".
+	for (track = 1; track <= playlistMax; track++)
+	{
+		tracks[track].frames = 0;
+		tracks[track].tenths = 0;
+		playlistGet(track);
+		// Blank lines (usually at the end of the file) aren't songs
+		if (vgmFileName == NULL)
+		{
+			continue;
+		}
+		printf("\nSong %u of %u\n", track, playlistMax);
+		startTime = clock();
+		if (outPath == NULL)
+		{
+			renderVGM(vgmFileName, NULL);
+		}
+		else
+		{
+			renderMakeFileName(outFileName, outPath, vgmFileName);
+			renderVGM(vgmFileName, outFileName);
+		}
+		tracks[track].frames = renderFrames;
+		tracks[track].tenths = ((uint32_t)(clock() - startTime) * 10) / CLOCKS_PER_SEC;
+		totalFrames += tracks[track].frames;
+		totalTenths += tracks[track].tenths;
+	}
+
+	// Job summary - how long each song took, then the whole lot
+	printf("\n  #  Song                      Audio     Time   Speed\n");
+	for (track = 1; track <= playlistMax; track++)
+	{
+		playlistGet(track);
+		if (vgmFileName == NULL)
+		{
+			continue;
+		}
+		audioTenths = tracks[track].frames / (OPL_EMU_RATE / 10);
+		printf("%3u  %-24.24s %5lu.%lus %5lu.%lus", track, vgmFileName, audioTenths / 10, audioTenths % 10, tracks[track].tenths / 10, tracks[track].tenths % 10);
+		if (tracks[track].tenths > 0)
+		{
+			printf("  %4lux", audioTenths / tracks[track].tenths);
+		}
+		printf("\n");
+	}
+	audioTenths = totalFrames / (OPL_EMU_RATE / 10);
+	printf("     %-24.24s %5lu.%lus %5lu.%lus", "Total", audioTenths / 10, audioTenths % 10, totalTenths / 10, totalTenths % 10);
+	if (totalTenths > 0)
+	{
+		printf("  %4lux", audioTenths / totalTenths);
+	}
+	printf("\n");
+	free(tracks);
+}
+
+void renderMakeFileName(char* outFileName, char* outPath, char* inFileName)
+{
+	char* baseName = inFileName;
+	uint8_t i;
+	uint16_t length;
+
+	// Just the name part of the VGM, without its folder or extension...
+	for (i = 0; inFileName[i] != '\0'; i++)
+	{
+		if (inFileName[i] == '\\' || inFileName[i] == '/' || inFileName[i] == ':')
+		{
+			baseName = &inFileName[i + 1];
+		}
+	}
+	// ...tacked onto the end of the output folder
+	strcpy(outFileName, outPath);
+	length = strlen(outFileName);
+	if (length > 0 && outFileName[length - 1] != '\\' && outFileName[length - 1] != ':')
+	{
+		outFileName[length++] = '\\';
+	}
+	for (i = 0; i < 8 && baseName[i] != '\0' && baseName[i] != '.'; i++)
+	{
+		outFileName[length++] = baseName[i];
+	}
+	strcpy(&outFileName[length], ".WAV");
+}
+
+void renderCompareBlock(int16_t *buffer, uint16_t frames)
+{
+	uint16_t i;
+	uint16_t diff;
+	uint8_t differs;
+
+	generateEmulatorBlock(oplEmuReference, renderCheckBuffer, frames);
+	for (i = 0; i < frames; i++)
+	{
+		// Add up the power of the reference and of the difference for the signal-to-noise ratio
+		renderCheckSignal += (double)renderCheckBuffer[i * 2] * renderCheckBuffer[i * 2] + (double)renderCheckBuffer[i * 2 + 1] * renderCheckBuffer[i * 2 + 1];
+		renderCheckNoise += (double)(buffer[i * 2] - renderCheckBuffer[i * 2]) * (buffer[i * 2] - renderCheckBuffer[i * 2]);
+		renderCheckNoise += (double)(buffer[i * 2 + 1] - renderCheckBuffer[i * 2 + 1]) * (buffer[i * 2 + 1] - renderCheckBuffer[i * 2 + 1]);
+
+		differs = FALSE;
+		diff = (uint16_t)abs(buffer[i * 2] - renderCheckBuffer[i * 2]);
+		if (diff > 0)
+		{
+			differs = TRUE;
+			if (diff > renderCheckMaxDiff)
+			{
+				renderCheckMaxDiff = diff;
+			}
+		}
+		diff = (uint16_t)abs(buffer[i * 2 + 1] - renderCheckBuffer[i * 2 + 1]);
+		if (diff > 0)
+		{
+			differs = TRUE;
+			if (diff > renderCheckMaxDiff)
+			{
+				renderCheckMaxDiff = diff;
+			}
+		}
+		if (differs == TRUE)
+		{
+			renderCheckDiffs++;
+		}
+	}
+}
+
+void renderWriteBlock(int16_t *buffer, uint16_t frames)
+{
+	uint16_t outFrames = frames;
+
+	if (renderFilePointer == NULL && goldenActive == FALSE)
+	{
+		return;
+	}
+	if (renderOutRate != OPL_EMU_RATE)
+	{
+		outFrames = resampleBlock(&renderResampler, buffer, frames, renderOutBuffer);
+		buffer = renderOutBuffer;
+	}
+	// A golden check looks at exactly what would have gone in the WAV
+	if (goldenActive == TRUE)
+	{
+		goldenAudio(buffer, outFrames);
+	}
+	if (renderFilePointer != NULL)
+	{
+		fwrite(buffer, sizeof(int16_t) * 2, outFrames, renderFilePointer);
+	}
+	renderOutFrames += outFrames;
+}
+
+void renderWriteStems(uint16_t frames)
+{
+	uint8_t stem;
+	uint16_t i;
+	uint16_t outFrames;
+	uint32_t silentFrames;
+	uint8_t sound;
+	char stemFileName[PATH_MAX];
+
+	if (renderStems == FALSE || frames == 0)
+	{
+		return;
+	}
+	for (stem = 0; stem < OPL_EMU_STEMS; stem++)
+	{
+		// Pull this stem out of the interleaved block
+		sound = FALSE;
+		for (i = 0; i < frames; i++)
+		{
+			renderStemIn[i * 2] = renderStemBuffer[(i * OPL_EMU_STEMS + stem) * 2];
+			renderStemIn[i * 2 + 1] = renderStemBuffer[(i * OPL_EMU_STEMS + stem) * 2 + 1];
+			if (renderStemIn[i * 2] != 0 || renderStemIn[i * 2 + 1] != 0)
+			{
+				sound = TRUE;
+			}
+		}
+		if (renderStemFiles[stem] == NULL)
+		{
+			// Channels the song never uses don't get a file at all
+			if (sound == FALSE)
+			{
+				continue;
+			}
+			sprintf(stemFileName, "%s%s.WAV", renderStemPrefix, renderStemNames[stem]);
+			errno = 0;
+			renderFileName = stemFileName;
+			renderStemFiles[stem] = fopen(stemFileName, "wb");
+			if (renderStemFiles[stem] == NULL)
+			{
+				killProgram(ERROR_RENDER_OUTPUT_FAILED);
+			}
+			renderWriteHeader(renderStemFiles[stem], 0);
+			// It has to line up with all the others, so make up the silence before its first sound.
+			// That goes through the resampler too, to keep its position in step.
+			memset(renderStemOut, 0, sizeof(renderStemOut));
+			for (silentFrames = renderFrames; silentFrames > 0; silentFrames -= i)
+			{
+				i = RENDER_STEM_FRAMES;
+				if (silentFrames < i)
+				{
+					i = (uint16_t)silentFrames;
+				}
+				outFrames = i;
+				if (renderOutRate != OPL_EMU_RATE)
+				{
+					outFrames = resampleBlock(&renderStemResamplers[stem], renderStemOut, i, renderStemOut);
+				}
+				fwrite(renderStemOut, sizeof(int16_t) * 2, outFrames, renderStemFiles[stem]);
+				renderStemFrames[stem] += outFrames;
+			}
+		}
+		outFrames = frames;
+		if (renderOutRate != OPL_EMU_RATE)
+		{
+			outFrames = resampleBlock(&renderStemResamplers[stem], renderStemIn, frames, renderStemOut);
+			fwrite(renderStemOut, sizeof(int16_t) * 2, outFrames, renderStemFiles[stem]);
+		}
+		else
+		{
+			fwrite(renderStemIn, sizeof(int16_t) * 2, outFrames, renderStemFiles[stem]);
+		}
+		renderStemFrames[stem] += outFrames;
+	}
+}
+
+void renderWriteHeader(FILE *wavFile, uint32_t dataBytes)
+{
+	// RIFF chunk
+	fwrite("RIFF", 1, 4, wavFile);
+	renderWriteDword(wavFile, dataBytes + 36);
+	fwrite("WAVE", 1, 4, wavFile);
+	// Format chunk: PCM, stereo, 16-bit, at the chip's own rate or whatever it's being resampled to
+	fwrite("fmt ", 1, 4, wavFile);
+	renderWriteDword(wavFile, 16);
+	renderWriteWord(wavFile, 1);
+	renderWriteWord(wavFile, 2);
+	renderWriteDword(wavFile, renderOutRate);
+	renderWriteDword(wavFile, renderOutRate * 4);
+	renderWriteWord(wavFile, 4);
+	renderWriteWord(wavFile, 16);
+	// Data chunk
+	fwrite("data", 1, 4, wavFile);
+	renderWriteDword(wavFile, dataBytes);
+}
+
+void renderWriteWord(FILE *wavFile, uint16_t value)
+{
+	fputc(value & 0xFF, wavFile);
+	fputc(value >> 8, wavFile);
+}
+
+void renderWriteDword(FILE *wavFile, uint32_t value)
+{
+	renderWriteWord(wavFile, (uint16_t)(value & 0xFFFF));
+	renderWriteWord(wavFile, (uint16_t)(value >> 16));
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// RENDER.H - Render a VGM to a WAV file with the software emulator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_RENDER_H
+#define VGMSLAP_RENDER_H
+
+#include <stdio.h>
+
+#include "types.h"
+
+// How many stereo samples to collect before writing them to disk
+#define RENDER_BUFFER_FRAMES 512
+
+// Stem rendering works in shorter runs, since there's a buffer for every channel
+#define RENDER_STEM_FRAMES 32
+
+// Longest fade-out at the end of a looping song, in 44100hz VGM samples (8 seconds)
+#define RENDER_FADE_SAMPLES 352800
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// How one song of a playlist render went, for the summary at the end
+typedef struct
+{
+	uint32_t frames;		// Stereo samples the emulator made (at its own rate)
+	uint32_t tenths;		// How long it took, in tenths of a second
+} renderTrack;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void renderVGM(char* inFileName, char* outFileName);		// Play a VGM into the emulator as fast as possible and save the output as a WAV
+void renderPlaylist(char* outPath);						// Render (or check, if outPath is NULL) every song in the playlist named by fileName, then sum up
+void renderMakeFileName(char* outFileName, char* outPath, char* inFileName);	// Work out a song's WAV name: the output folder plus the VGM's name
+void renderCompareBlock(int16_t *buffer, uint16_t frames);	// Check a block against the reference emulator and keep score
+void renderWriteBlock(int16_t *buffer, uint16_t frames);	// Resample (if needed) and write a block of finished audio to the WAV
+void renderWriteStems(uint16_t frames);						// Split the stem buffer up and write each stem to its own WAV
+void renderWriteHeader(FILE *wavFile, uint32_t dataBytes);	// Write (or rewrite) the 44 byte WAV header
+void renderWriteWord(FILE *wavFile, uint16_t value);		// Write a little-endian 16-bit value
+void renderWriteDword(FILE *wavFile, uint32_t value);		// Write a little-endian 32-bit value
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint8_t renderMode;			// Set when running headless from the command line - no video, no timer
+extern char* renderFileName;		// Name of the WAV file being written
+extern FILE *renderFilePointer;		// WAV file being written
+extern uint32_t renderFrames;		// How many stereo samples the emulator has made so far
+extern uint32_t renderOutFrames;	// How many stereo samples have been written to the WAV (fewer than renderFrames if resampling)
+extern uint32_t renderOutRate;		// Sample rate of the WAV
+extern uint8_t renderCheck;			// Set by /C - compare against the reference emulator instead of writing a WAV
+extern uint32_t renderCheckDiffs;	// How many samples didn't match the reference
+extern uint16_t renderCheckMaxDiff;	// Biggest difference seen
+extern uint8_t renderStems;			// Set by /S - write each channel to its own WAV instead of the mix
+extern char* renderStemPrefix;		// Start of each stem's file name
+extern uint32_t renderBlocks;		// How many runs of samples the emulator was asked for (one per gap between commands)
+
+#endif
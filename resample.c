@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// RESAMPLE.C - Convert the emulator's 49716hz output to 44100hz or 48000hz
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "oplemu.h"
+#include "resample.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+int16_t far resampleFilter[RESAMPLE_PHASES + 1][RESAMPLE_MAX_TAPS];
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void resampleBuildFilter(uint32_t inRate, uint32_t outRate, uint8_t taps)
+{
+	uint16_t phase;
+	uint8_t tap;
+	double cutoff;
+	double x;
+	double window;
+	double value;
+	double total;
+	double row[RESAMPLE_MAX_TAPS];
+	int32_t fixedTotal;
+
+	// Cutoff in cycles per input sample.  Everything above the output's Nyquist frequency has to go, or it folds back down as aliasing.
+	cutoff = 0.5 * RESAMPLE_PASSBAND * (double)outRate / (double)inRate;
+
+	for (phase = 0; phase <= RESAMPLE_PHASES; phase++)
+	{
+		// Windowed sinc, centred between the middle two taps and nudged along by the phase
+		total = 0;
+		for (tap = 0; tap < taps; tap++)
+		{
+			x = (double)(taps / 2 - 1 - tap) + (double)phase / RESAMPLE_PHASES;
+			if (x == 0)
+			{
+				value = 2.0 * cutoff;
+			}
+			else
+			{
+				value = sin(2.0 * 3.14159265358979 * cutoff * x) / (3.14159265358979 * x);
+			}
+			window = 1.0 - (x / (taps / 2)) * (x / (taps / 2));
+			if (window < 0)
+			{
+				window = 0;
+			}
+			value *= resampleBessel(RESAMPLE_KAISER_BETA * sqrt(window)) / resampleBessel(RESAMPLE_KAISER_BETA);
+			row[tap] = value;
+			total += value;
+		}
+		// Scale every row to add up to exactly 1.0 so a steady level comes out unchanged whatever the phase
+		fixedTotal = 0;
+		for (tap = 0; tap < taps; tap++)
+		{
+			resampleFilter[phase][tap] = (int16_t)floor(row[tap] / total * (1 << RESAMPLE_COEF_BITS) + 0.5);
+			fixedTotal += resampleFilter[phase][tap];
+		}
+		// Rounding can leave it a step or two out, so put the difference on the biggest tap
+		resampleFilter[phase][taps / 2 - 1 + (phase >= RESAMPLE_PHASES / 2)] += (int16_t)((1 << RESAMPLE_COEF_BITS) - fixedTotal);
+	}
+}
+
+void resampleInit(resampleState *state, uint32_t inRate, uint32_t outRate, uint8_t taps)
+{
+	memset(state, 0, sizeof(resampleState));
+	state->step = (inRate << 16) / outRate;
+	state->taps = taps;
+}
+
+uint16_t resampleBlock(resampleState *state, int16_t *in, uint16_t inFrames, int16_t *out)
+{
+	uint16_t outFrames = 0;
+	uint8_t taps = state->taps;
+	uint8_t tap;
+	uint8_t side;
+	uint16_t phase;
+	int16_t blend;
+	int16_t *window;
+	int16_t far *coefA;
+	int16_t far *coefB;
+	int32_t totalA;
+	int32_t totalB;
+	int32_t result;
+
+	while (inFrames > 0)
+	{
+		// Add the next input sample to the history.  It goes in twice, once in each half, so the last "taps" samples
+		// are always sitting next to each other starting at historyPos.
+		state->history[0][state->historyPos] = in[0];
+		state->history[0][state->historyPos + taps] = in[0];
+		state->history[1][state->historyPos] = in[1];
+		state->history[1][state->historyPos + taps] = in[1];
+		state->historyPos++;
+		if (state->historyPos == taps)
+		{
+			state->historyPos = 0;
+		}
+		in += 2;
+		inFrames--;
+
+		// Make every output sample that falls before the next input sample
+		while (state->position < 0x10000UL)
+		{
+			phase = (uint16_t)(state->position >> (16 - RESAMPLE_PHASE_BITS));
+			blend = (int16_t)((state->position >> (16 - RESAMPLE_PHASE_BITS - 8)) & 0xFF);
+			coefA = resampleFilter[phase];
+			coefB = resampleFilter[phase + 1];
+			for (side = 0; side < 2; side++)
+			{
+				window = &state->history[side][state->historyPos];
+				totalA = 0;
+				totalB = 0;
+				for (tap = 0; tap < taps; tap++)
+				{
+					totalA += (int32_t)window[tap] * coefA[tap];
+					totalB += (int32_t)window[tap] * coefB[tap];
+				}
+				// Blend between the two nearest phases
+				totalA >>= RESAMPLE_COEF_BITS;
+				totalB >>= RESAMPLE_COEF_BITS;
+				result = totalA + (((totalB - totalA) * blend) >> 8);
+				if (result > 32767)
+				{
+					result = 32767;
+				}
+				else if (result < -32768)
+				{
+					result = -32768;
+				}
+				out[side] = (int16_t)result;
+			}
+			out += 2;
+			outFrames++;
+			state->position += state->step;
+		}
+		state->position -= 0x10000UL;
+	}
+	return outFrames;
+}
+
+double resampleBessel(double x)
+{
+	double total = 1.0;
+	double term = 1.0;
+	uint8_t k;
+
+	// Power series - it converges quickly for the sizes a Kaiser window needs
+	for (k = 1; k < 25; k++)
+	{
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		total += term;
+	}
+	return total;
+}
+
+void resampleReport(uint32_t outRate)
+{
+	// Test tones, in hz.  The last few are above the output's Nyquist frequency, so they should come out as close to nothing as possible.
+	static const uint16_t testFrequencies[] = {100, 1000, 5000, 10000, 15000, 18000, 19000, 20000, 21000, 22000, 23000, 24000};
+	static const uint8_t testTaps[] = {8, 16, 32};
+	static int16_t inBuffer[512 * 2];
+	static int16_t outBuffer[513 * 2];
+	resampleState state;
+	uint8_t t;
+	uint8_t f;
+	uint16_t i;
+	uint16_t block;
+	uint16_t outFrames;
+	uint32_t inFrame;
+	uint32_t outCount;
+	double power;
+	double inPower;
+	clock_t startTime;
+	clock_t elapsed;
+
+	printf("Resampler response, %luhz to %luhz (gain in dB)\n\n", (uint32_t)OPL_EMU_RATE, outRate);
+	printf("    Hz");
+	for (t = 0; t < sizeof(testTaps); t++)
+	{
+		printf("  %2u taps", testTaps[t]);
+	}
+	printf("\n");
+	for (f = 0; f < sizeof(testFrequencies) / sizeof(testFrequencies[0]); f++)
+	{
+		printf("%6u", testFrequencies[f]);
+		for (t = 0; t < sizeof(testTaps); t++)
+		{
+			resampleBuildFilter(OPL_EMU_RATE, outRate, testTaps[t]);
+			resampleInit(&state, OPL_EMU_RATE, outRate, testTaps[t]);
+			// Push a sine wave through and measure what comes out, after giving the filter a moment to fill up
+			inFrame = 0;
+			outCount = 0;
+			power = 0;
+			inPower = 0;
+			for (block = 0; block < 16; block++)
+			{
+				for (i = 0; i < 512; i++)
+				{
+					inBuffer[i * 2] = (int16_t)(16384.0 * sin(2.0 * 3.14159265358979 * testFrequencies[f] * (double)inFrame / OPL_EMU_RATE));
+					inBuffer[i * 2 + 1] = inBuffer[i * 2];
+					inPower += (double)inBuffer[i * 2] * inBuffer[i * 2];
+					inFrame++;
+				}
+				outFrames = resampleBlock(&state, inBuffer, 512, outBuffer);
+				for (i = 0; i < outFrames; i++)
+				{
+					if (block > 0)
+					{
+						power += (double)outBuffer[i * 2] * outBuffer[i * 2];
+						outCount++;
+					}
+				}
+			}
+			power /= outCount;
+			inPower /= inFrame;
+			if (power > 0)
+			{
+				printf("  %7.1f", 10.0 * log10(power / inPower));
+			}
+			else
+			{
+				printf("     -inf");
+			}
+		}
+		printf("\n");
+	}
+
+	// Speed - how long does 60 seconds of audio take?
+	printf("\nSpeed (60 seconds of audio)\n\n");
+	for (i = 0; i < 512 * 2; i++)
+	{
+		inBuffer[i] = (int16_t)(i * 61);
+	}
+	for (t = 0; t < sizeof(testTaps); t++)
+	{
+		resampleBuildFilter(OPL_EMU_RATE, outRate, testTaps[t]);
+		resampleInit(&state, OPL_EMU_RATE, outRate, testTaps[t]);
+		startTime = clock();
+		for (inFrame = 0; inFrame < (uint32_t)OPL_EMU_RATE * 60; inFrame += 512)
+		{
+			resampleBlock(&state, inBuffer, 512, outBuffer);
+		}
+		elapsed = clock() - startTime;
+		printf("%2u taps: %lu.%02lus", testTaps[t], (uint32_t)elapsed / CLOCKS_PER_SEC, ((uint32_t)elapsed * 100 / CLOCKS_PER_SEC) % 100);
+		if (elapsed > 0)
+		{
+			printf(" (%lux real-time)", (uint32_t)(60 * CLOCKS_PER_SEC / elapsed));
+		}
+		printf("\n");
+	}
+}
@@ -0,0 +1,69 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// RESAMPLE.H - Convert the emulator's 49716hz output to 44100hz or 48000hz
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_RESAMPLE_H
+#define VGMSLAP_RESAMPLE_H
+
+#include "types.h"
+
+// The filter is worked out for this many points in between two input samples.  Anything in between those gets
+// blended from the two nearest, so it doesn't need to be huge.  Must be a power of 2.
+#define RESAMPLE_PHASE_BITS 7
+#define RESAMPLE_PHASES (1 << RESAMPLE_PHASE_BITS)
+
+// Longest filter allowed (TAPS in VGMSLAP.CFG can be 8, 16 or 32)
+#define RESAMPLE_MAX_TAPS 32
+
+// Filter coefficients are 2.14 fixed point, so a 32 tap filter can't overflow a 32-bit total
+#define RESAMPLE_COEF_BITS 14
+
+// How much of the space below the output's Nyquist frequency to keep.  The rest is room for the filter to roll off.
+#define RESAMPLE_PASSBAND 0.9
+
+// Kaiser window shape - higher gives a deeper stopband but a wider roll-off
+#define RESAMPLE_KAISER_BETA 6.0
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// Everything one stream needs to carry from one block to the next
+typedef struct
+{
+	uint32_t step;			// How far the input moves per output sample, 16.16 fixed point
+	uint32_t position;		// Where the next output sample falls after the newest input sample, 16.16 fixed point
+	uint8_t taps;
+	uint8_t historyPos;		// Where the next input sample goes in the history
+	int16_t history[2][RESAMPLE_MAX_TAPS * 2];	// Last few input samples for each side, written twice so a whole filter's worth is always in one piece
+} resampleState;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void resampleBuildFilter(uint32_t inRate, uint32_t outRate, uint8_t taps);	// Work out the filter table for a rate conversion (only needs doing once per rate/taps setting)
+void resampleInit(resampleState *state, uint32_t inRate, uint32_t outRate, uint8_t taps);	// Start a new stream
+uint16_t resampleBlock(resampleState *state, int16_t *in, uint16_t inFrames, int16_t *out);	// Convert interleaved stereo input, returns how many output frames came out
+double resampleBessel(double x);											// Modified Bessel function I0, for the Kaiser window
+void resampleReport(uint32_t outRate);										// /R - print the frequency response and speed of each filter length
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern int16_t far resampleFilter[RESAMPLE_PHASES + 1][RESAMPLE_MAX_TAPS];	// One row of coefficients per phase, plus one extra to blend towards
+
+#endif
@@ -18,7 +18,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "oplemu.h"
+#include "resample.h"
 #include "settings.h"
+#include "stream.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Initialize variables
@@ -35,7 +38,7 @@ programSettings settings;
 void setConfig(void)
 {
 	char keyName[9];
-	char keyValueText[8];
+	char keyValueText[9];
 	uint16_t keyValueHex;
 	uint16_t keyValueDecimal;
 	char configLineBuffer[80];	// Buffer of a config line.  I picked 80 chars cause... uh... DOS
@@ -74,6 +77,12 @@ void setConfig(void)
 			// Timing frequency divider
 			if (strcmp(keyName, "DIVIDER") == 0)
 			{
+				// Automatic tuning - start at 1 and let the player work it out
+				if (strcmp(keyValueText, "AUTO") == 0)
+				{
+					settings.autoDivider = 1;
+					keyValueDecimal = 1;
+				}
 				// Bounds check
 				if (keyValueDecimal < 1)
 				{
@@ -95,6 +104,110 @@ void setConfig(void)
 				}
 				settings.struggleBus = keyValueDecimal;
 			}
+			// ISR write mode (timer interrupt sends the OPL writes)
+			if (strcmp(keyName, "ISRWRITE") == 0)
+			{
+				// Bounds check
+				if (keyValueDecimal > 1)
+				{
+					keyValueDecimal = 1;
+				}
+				settings.isrWrite = keyValueDecimal;
+			}
+			// Software OPL emulator instead of a real card
+			if (strcmp(keyName, "EMULATOR") == 0)
+			{
+				// Bounds check
+				if (keyValueDecimal > 4)
+				{
+					keyValueDecimal = 4;
+				}
+				settings.emulator = keyValueDecimal;
+			}
+			// Emulator shortcut for silent stretches
+			if (strcmp(keyName, "SKIPIDLE") == 0)
+			{
+				// Bounds check
+				if (keyValueDecimal > 1)
+				{
+					keyValueDecimal = 1;
+				}
+				settings.skipIdle = keyValueDecimal;
+			}
+			// Sample rate for rendered WAVs
+			if (strcmp(keyName, "RATE") == 0)
+			{
+				// Bounds check - the resampler only goes down, and anything below 8000hz isn't worth having
+				if (keyValueDecimal >= OPL_EMU_RATE || keyValueDecimal < 8000)
+				{
+					keyValueDecimal = 0;
+				}
+				settings.outputRate = keyValueDecimal;
+			}
+			// Resampling filter length
+			if (strcmp(keyName, "TAPS") == 0)
+			{
+				// Round up to one of the lengths we have
+				if (keyValueDecimal <= 8)
+				{
+					keyValueDecimal = 8;
+				}
+				else if (keyValueDecimal <= 16)
+				{
+					keyValueDecimal = 16;
+				}
+				else
+				{
+					keyValueDecimal = RESAMPLE_MAX_TAPS;
+				}
+				settings.resampleTaps = keyValueDecimal;
+			}
+			// Live emulator output latency
+			if (strcmp(keyName, "LATENCY") == 0)
+			{
+				// Bounds check - any less than about 10ms and a single screen redraw would cause a dropout
+				if (keyValueDecimal < 10)
+				{
+					keyValueDecimal = 10;
+				}
+				if (keyValueDecimal > STREAM_MAX_LATENCY)
+				{
+					keyValueDecimal = STREAM_MAX_LATENCY;
+				}
+				settings.latency = keyValueDecimal;
+			}
+			// Register write trace
+			if (strcmp(keyName, "TRACE") == 0)
+			{
+				// Bounds check
+				if (keyValueDecimal > 1)
+				{
+					keyValueDecimal = 1;
+				}
+				settings.trace = keyValueDecimal;
+			}
+			// Channel table drawing time limit
+			if (strcmp(keyName, "DRAWTIME") == 0)
+			{
+				// Bounds check
+				if (keyValueDecimal > 100)
+				{
+					keyValueDecimal = 100;
+				}
+				settings.drawTime = keyValueDecimal;
+			}
+			// Emulator quality
+			if (strcmp(keyName, "QUALITY") == 0)
+			{
+				if (strcmp(keyValueText, "FAST") == 0)
+				{
+					settings.quality = 1;
+				}
+				else if (strcmp(keyValueText, "ACCURATE") == 0)
+				{
+					settings.quality = 0;
+				}
+			}
 		}
 	}
 }
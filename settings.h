@@ -23,7 +23,18 @@
 #define CONFIG_DEFAULT_PORT 0x388
 #define CONFIG_DEFAULT_LOOPS 1
 #define CONFIG_DEFAULT_DIVIDER 1
+#define CONFIG_DEFAULT_AUTODIVIDER 0
 #define CONFIG_DEFAULT_STRUGGLE 0
+#define CONFIG_DEFAULT_ISRWRITE 0
+#define CONFIG_DEFAULT_EMULATOR 0
+#define CONFIG_DEFAULT_SKIPIDLE 1
+#define CONFIG_DEFAULT_QUALITY 0
+#define CONFIG_DEFAULT_RATE 44100
+#define CONFIG_DEFAULT_TAPS 16
+#define CONFIG_DEFAULT_LATENCY 100
+#define CONFIG_DEFAULT_TRACE 0
+#define CONFIG_DEFAULT_GOLDSLOW 20
+#define CONFIG_DEFAULT_DRAWTIME 50
 
 ///////////////////////////////////////////////////////////////////////////////
 // Function declarations
@@ -45,10 +56,23 @@ typedef struct
 {
 	char filePath[PATH_MAX];
 	char tempPath[PATH_MAX];
+	char logPath[PATH_MAX];
+	char tracePath[PATH_MAX];
 	uint16_t oplBase;
 	uint8_t loopCount;
 	uint8_t frequencyDivider; // Range should be 1-100
+	uint8_t autoDivider;	// Pick the divider automatically based on measured load ("DIVIDER AUTO")
 	uint8_t struggleBus;
+	uint8_t isrWrite;	// Send OPL writes from the timer interrupt instead of the main loop
+	uint8_t emulator;	// 0 = real OPL card, otherwise which chip to emulate (same numbering as OplDetectedType)
+	uint8_t skipIdle;	// Let the emulator stop running the operators while everything is silent
+	uint8_t quality;	// 0 = accurate emulator, 1 = fast (same numbering as OPL_EMU_QUALITY_*)
+	uint16_t outputRate;	// Sample rate for rendered WAVs, 0 = the chip's own rate
+	uint8_t resampleTaps;	// Length of the resampling filter - 8, 16 or 32
+	uint16_t latency;	// How far behind the music the live emulator output runs, in milliseconds
+	uint8_t trace;	// Record every OPL write to VGMSLAP.TRC from the moment the program starts
+	uint8_t goldenSlow;	// How many percent slower than its golden a song can render before VGMSLAP /G calls it out (0 = don't check)
+	uint8_t drawTime;	// How many percent of each screen refresh the channel table can take drawing (0 = as long as it needs)
 } programSettings;
 
 // Storage spot for program settings
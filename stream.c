@@ -0,0 +1,290 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// STREAM.C - Live emulator output while playing, to a file or device
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+
+#include "opl.h"
+#include "render.h"
+#include "resample.h"
+#include "settings.h"
+#include "stream.h"
+#include "timer.h"
+#include "vgm.h"
+#include "vgmslap.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t streamActive = FALSE;
+FILE *streamFilePointer = NULL;
+oplEvent streamWriteQueue[STREAM_WRITE_QUEUE_SIZE];
+uint8_t streamWriteHead = 0;
+uint8_t streamWriteTail = 0;
+int16_t far streamBlocks[STREAM_BLOCKS][STREAM_BLOCK_FRAMES * 2];
+uint8_t streamBlockHead = 0;
+uint8_t streamBlockTail = 0;
+uint32_t streamBlockReady[STREAM_BLOCKS];
+uint32_t streamUnderruns = 0;
+uint32_t streamOverruns = 0;
+uint32_t streamFramesWritten = 0;
+int16_t streamSynthBuffer[STREAM_BLOCK_FRAMES * 2];	// Block the synthesizer is working on
+uint16_t streamSynthFill = 0;						// How much of it is done
+int16_t streamSinkBuffer[STREAM_BLOCK_FRAMES * 2];	// Block on its way out (fwrite wants it in near memory)
+uint32_t streamClockStep = 0;						// Synthesizer's clock, same as rendering: a fraction of a VGM sample in 1/49716ths...
+uint32_t streamVgmSample = 0;						// ...and the 44100hz VGM sample it's on
+uint32_t streamSinkFrames = 0;						// Stereo samples sent to the output this song
+uint32_t streamLatencyTicks = 0;					// How far behind the timer the output runs
+resampleState streamResampler;						// Converts to RATE on the way out, same as a WAV render
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void streamOpen(char* sinkFileName)
+{
+	errno = 0;
+	renderFileName = sinkFileName;
+	// Same rate as a WAV render would be, so the header has to know about it before it's written
+	renderOutRate = OPL_EMU_RATE;
+	if (settings.outputRate != 0 && settings.outputRate < OPL_EMU_RATE)
+	{
+		renderOutRate = settings.outputRate;
+		resampleBuildFilter(OPL_EMU_RATE, renderOutRate, settings.resampleTaps);
+		// Only once for the whole session - it's all one WAV, so the filter carries straight on from one song into the next
+		resampleInit(&streamResampler, OPL_EMU_RATE, renderOutRate, settings.resampleTaps);
+	}
+	streamFilePointer = fopen(sinkFileName, "wb");
+	if (streamFilePointer == NULL)
+	{
+		killProgram(ERROR_RENDER_OUTPUT_FAILED);
+	}
+	// Size isn't known yet.  If it's a file, the header gets fixed up at the end.
+	renderWriteHeader(streamFilePointer, 0);
+	streamLatencyTicks = ((uint32_t)settings.latency * 441) / 10;
+	streamUnderruns = 0;
+	streamOverruns = 0;
+	streamFramesWritten = 0;
+}
+
+void streamStart(void)
+{
+	// The timer has just gone back to zero, so everything else does too
+	streamWriteHead = 0;
+	streamWriteTail = 0;
+	streamBlockHead = 0;
+	streamBlockTail = 0;
+	streamSynthFill = 0;
+	streamClockStep = 0;
+	streamVgmSample = 0;
+	streamSinkFrames = 0;
+	streamActive = TRUE;
+}
+
+void streamPushWrite(uint16_t reg, uint8_t data)
+{
+	if (streamWriteQueueFull())
+	{
+		// The synthesizer has fallen too far behind command processing.  Give it a chance to catch up right now.
+		streamOverruns++;
+		streamSynthesize(dataCurrentSample);
+		// Still full means the output is backed up as well, so there's nothing for it but to send the oldest write
+		// to the chip early.  It'll be a little off, but nothing gets lost.
+		if (streamWriteQueueFull())
+		{
+			writeOPLEmulator(streamWriteQueue[streamWriteTail].reg, streamWriteQueue[streamWriteTail].data);
+			streamWriteTail++;
+		}
+	}
+	// Write commands don't move dataCurrentSample, so it's exactly the sample this write is due on
+	streamWriteQueue[streamWriteHead].sample = dataCurrentSample;
+	streamWriteQueue[streamWriteHead].reg = reg;
+	streamWriteQueue[streamWriteHead].data = data;
+	streamWriteHead++;
+}
+
+void streamSynthesize(uint32_t limit)
+{
+	uint16_t frames;
+	uint32_t nextStep;
+	uint32_t nextSample;
+
+	// Only samples before "limit" are safe to make - a command that hasn't been read yet could still land on it
+	while (1)
+	{
+		nextStep = streamClockStep + 44100;
+		nextSample = streamVgmSample;
+		if (nextStep >= OPL_EMU_RATE)
+		{
+			nextStep -= OPL_EMU_RATE;
+			nextSample++;
+		}
+		if (nextSample >= limit || streamBlocksFull())
+		{
+			break;
+		}
+		streamClockStep = nextStep;
+		streamVgmSample = nextSample;
+
+		// Send everything due on or before this sample, then run on until the next write is due.
+		// This is the same loop renderVGM() uses, so the output matches a WAV render exactly as long as nothing runs late.
+		while (!streamWriteQueueEmpty() && streamWriteQueue[streamWriteTail].sample <= streamVgmSample)
+		{
+			writeOPLEmulator(streamWriteQueue[streamWriteTail].reg, streamWriteQueue[streamWriteTail].data);
+			streamWriteTail++;
+		}
+		frames = 1;
+		while (streamSynthFill + frames < STREAM_BLOCK_FRAMES)
+		{
+			nextStep = streamClockStep + 44100;
+			nextSample = streamVgmSample;
+			if (nextStep >= OPL_EMU_RATE)
+			{
+				nextStep -= OPL_EMU_RATE;
+				nextSample++;
+			}
+			if (nextSample >= limit || (!streamWriteQueueEmpty() && nextSample >= streamWriteQueue[streamWriteTail].sample))
+			{
+				break;
+			}
+			streamClockStep = nextStep;
+			streamVgmSample = nextSample;
+			frames++;
+		}
+		generateOPLBlock(&streamSynthBuffer[streamSynthFill * 2], frames);
+		streamSynthFill += frames;
+
+		// Finished a block - hand it over to the output
+		if (streamSynthFill == STREAM_BLOCK_FRAMES)
+		{
+			_fmemcpy(streamBlocks[streamBlockHead], streamSynthBuffer, sizeof(streamSynthBuffer));
+			streamBlockReady[streamBlockHead] = tickCounter;
+			streamBlockHead = (streamBlockHead + 1) & (STREAM_BLOCKS - 1);
+			streamSynthFill = 0;
+		}
+	}
+
+	// Writes due on the very next sample can go to the chip now - nothing gets generated in between, so it's no different.
+	// This keeps a burst of writes on one sample (like a song's setup) from filling the queue.
+	while (!streamWriteQueueEmpty() && streamWriteQueue[streamWriteTail].sample <= nextSample)
+	{
+		writeOPLEmulator(streamWriteQueue[streamWriteTail].reg, streamWriteQueue[streamWriteTail].data);
+		streamWriteTail++;
+	}
+}
+
+void streamSink(void)
+{
+	uint32_t dueFrames = 0;
+
+	// Where the output should have got to: wherever the timer is, minus the latency
+	if (tickCounter > streamLatencyTicks)
+	{
+		dueFrames = streamTicksToFrames(tickCounter - streamLatencyTicks);
+	}
+	while (streamSinkFrames + STREAM_BLOCK_FRAMES <= dueFrames)
+	{
+		// Nothing ready?  It might just be that the ring was full last time around, so try making some more first.
+		if (streamBlocksEmpty())
+		{
+			streamSynthesize(dataCurrentSample);
+			if (streamBlocksEmpty())
+			{
+				break;
+			}
+		}
+		// A sound card would have started playing this block a latency's worth after it began.  If it wasn't made by then,
+		// that's a dropout.  The file still gets the real audio so it can be checked, but count it.
+		if (streamBlockReady[streamBlockTail] > streamFramesToTicks(streamSinkFrames) + streamLatencyTicks)
+		{
+			streamUnderruns++;
+		}
+		streamSendBlock();
+		streamSinkFrames += STREAM_BLOCK_FRAMES;
+	}
+}
+
+void streamSendBlock(void)
+{
+	_fmemcpy(streamSinkBuffer, streamBlocks[streamBlockTail], sizeof(streamSinkBuffer));
+	streamBlockTail = (streamBlockTail + 1) & (STREAM_BLOCKS - 1);
+	streamWriteFrames(streamSinkBuffer, STREAM_BLOCK_FRAMES);
+}
+
+void streamWriteFrames(int16_t *buffer, uint16_t frames)
+{
+	// Resampling only ever goes down in rate, so it can work in place
+	if (renderOutRate != OPL_EMU_RATE)
+	{
+		frames = resampleBlock(&streamResampler, buffer, frames, buffer);
+	}
+	fwrite(buffer, sizeof(int16_t) * 2, frames, streamFilePointer);
+	streamFramesWritten += frames;
+}
+
+void streamFinish(void)
+{
+	uint32_t limit = dataCurrentSample;
+
+	if (streamActive == FALSE)
+	{
+		return;
+	}
+	// A skipped song may have read a long wait that's still in the future, so stop at wherever the timer is
+	if (limit > tickCounter)
+	{
+		limit = tickCounter;
+	}
+	// Play out everything that's left, no waiting
+	streamSynthesize(limit);
+	while (!streamBlocksEmpty())
+	{
+		streamSendBlock();
+		streamSynthesize(limit);
+	}
+	streamWriteFrames(streamSynthBuffer, streamSynthFill);
+	streamSynthFill = 0;
+	streamActive = FALSE;
+}
+
+void streamClose(void)
+{
+	if (streamFilePointer == NULL)
+	{
+		return;
+	}
+	// Quitting partway through a song still gets what's been played so far
+	streamFinish();
+	// Devices can't seek, so only a real file gets its header fixed up
+	if (fseek(streamFilePointer, 0, SEEK_SET) == 0)
+	{
+		renderWriteHeader(streamFilePointer, streamFramesWritten * 4);
+	}
+	fclose(streamFilePointer);
+	streamFilePointer = NULL;
+}
+
+uint32_t streamTicksToFrames(uint32_t ticks)
+{
+	// Split up so it doesn't overflow on long songs
+	return (ticks / 44100) * OPL_EMU_RATE + ((ticks % 44100) * OPL_EMU_RATE) / 44100;
+}
+
+uint32_t streamFramesToTicks(uint32_t frames)
+{
+	return (frames / OPL_EMU_RATE) * 44100 + ((frames % OPL_EMU_RATE) * 44100) / OPL_EMU_RATE;
+}
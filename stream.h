@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// STREAM.H - Live emulator output while playing, to a file or device
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_STREAM_H
+#define VGMSLAP_STREAM_H
+
+#include <stdio.h>
+
+#include "fifo.h"
+#include "types.h"
+
+// Same deal as the ISR write queue - 256 entries, so the 8-bit head/tail indexes wrap around on their own.
+// Command processing is the only thing that moves the head, and the synthesizer is the only thing that moves the tail.
+#define STREAM_WRITE_QUEUE_SIZE 256
+
+// Finished audio waits in a ring of blocks on its way to the output.  The block count must be a power of 2.
+#define STREAM_BLOCK_FRAMES 256
+#define STREAM_BLOCKS 32
+
+// Longest LATENCY allowed, in milliseconds.  A couple of blocks short of the whole ring so the synthesizer always has room to work.
+#define STREAM_MAX_LATENCY 150
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void streamOpen(char* sinkFileName);		// Open the output and get ready to stream (only once per session)
+void streamStart(void);						// Start a new song - the clocks go back to zero along with the timer
+void streamPushWrite(uint16_t reg, uint8_t data);	// Called by writeOPL() - queue a write for the synthesizer, due at dataCurrentSample
+void streamSynthesize(uint32_t limit);		// Run the emulator up to (not including) VGM sample "limit"
+void streamSink(void);						// Send any blocks that are due to the output
+void streamSendBlock(void);					// Send the oldest finished block to the output
+void streamWriteFrames(int16_t *buffer, uint16_t frames);	// Resample (if RATE asks for it) and write finished audio to the output
+void streamFinish(void);					// End of song - synthesize and send everything that's left
+void streamClose(void);						// Finish off, fix up the WAV header and close the output
+uint32_t streamTicksToFrames(uint32_t ticks);	// Convert 44100hz timer ticks to 49716hz emulator samples
+uint32_t streamFramesToTicks(uint32_t frames);	// ...and back
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint8_t streamActive;					// Set while a song is streaming - OPL writes get queued instead of going straight to the emulator
+extern FILE *streamFilePointer;					// Output file or device
+extern oplEvent streamWriteQueue[STREAM_WRITE_QUEUE_SIZE];	// Timestamped writes waiting for the synthesizer
+extern uint8_t streamWriteHead;
+extern uint8_t streamWriteTail;
+extern int16_t far streamBlocks[STREAM_BLOCKS][STREAM_BLOCK_FRAMES * 2];	// Finished audio waiting to go out
+extern uint8_t streamBlockHead;				// Next block the synthesizer will fill
+extern uint8_t streamBlockTail;				// Next block the output will take
+extern uint32_t streamBlockReady[STREAM_BLOCKS];	// Timer tick each block was finished on, to check it against its deadline
+extern uint32_t streamUnderruns;			// Blocks that were made too late to have played on time (a dropout on a real sound card)
+extern uint32_t streamOverruns;				// Times the write queue was full because the synthesizer couldn't keep up
+extern uint32_t streamFramesWritten;		// Total stereo samples sent to the output, silence included (at the output's rate)
+
+#define streamWriteQueueEmpty() (streamWriteHead == streamWriteTail)
+#define streamWriteQueueFull() ((uint8_t)(streamWriteHead + 1) == streamWriteTail)
+#define streamBlocksEmpty() (streamBlockHead == streamBlockTail)
+#define streamBlocksFull() (((streamBlockHead + 1) & (STREAM_BLOCKS - 1)) == streamBlockTail)
+
+#endif
@@ -0,0 +1,375 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TAUTODIV.C - Host simulation of DIVIDER AUTO (AUTODIV.C)
+//
+// Pretends to be a PC of a given speed playing a playlist of a given
+// busyness, with a cost (in CPU cycles) for the timer interrupt, each OPL
+// write, each screen draw and so on.  The main loop below is the same shape
+// as the one in VGMSLAP.C, and the timer interrupt steals its share of the
+// cycles as time goes by.  autoDividerPass and autoDividerRetune get the same
+// numbers they'd get on the real thing, and we check that the divider they
+// pick keeps the music on time and settles down instead of bouncing around.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+
+#include "autodiv.h"
+#include "settings.h"
+#include "timer.h"
+#include "vgm.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// What everything costs on one pretend machine, and how busy its songs are
+typedef struct
+{
+	char *name;
+	uint32_t cyclesPerTick;		// CPU cycles in one 44100hz tick (4.77MHz = 108)
+	uint32_t isrCycles;			// One run of the timer interrupt
+	uint32_t loopCycles;		// One pass of the main loop with nothing to do (keyboard, flush)
+	uint32_t writeCycles;		// Reading and sending one OPL write
+	uint32_t drawCycles;		// Drawing the channel table, on top of...
+	uint32_t drawWriteCycles;	// ...this much for each write since the last draw
+	uint32_t barCycles;			// The level bars
+	uint32_t burstWrites;		// The song is bursts of this many writes...
+	uint32_t burstGap;			// ...about this many ticks apart
+	uint8_t expectDivider;		// Largest divider we'd accept it settling on (0 = don't care)
+} simMachine;
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// The parts of the rest of VGMSlap that AUTODIV.C uses
+volatile uint32_t tickCounter = 0;
+uint8_t playbackFrequencyDivider = 1;
+programSettings settings;
+char *vgmFileName = "SIM.VGM";
+
+#define SIM_SONGS 12
+#define SIM_SONG_TICKS (44100UL * 20)
+#define SIM_SETTLED_SONGS 4		// The last this many songs have to agree on the divider and be on time
+
+simMachine simMachines[] = {
+	// Name                      cyc/tick  ISR  loop  write  draw  /write  bars  burst gap   expect
+	{"486DX2-66, light song",      1500,   120,  400,   150, 30000,   400, 20000,   10, 882,  1},
+	{"386SX-16, dense song",        360,   150,  300,   300, 60000,  1500, 40000,   30, 441,  0},
+	{"286-12, dense song",          272,   180,  250,   350, 70000,  1800, 50000,   40, 441,  0},
+	{"8088-4.77, light song",       108,    90,  200,   400, 30000,  2000, 20000,    9, 882,  0}
+};
+
+const simMachine *simCurrent;
+uint32_t simNow;				// Cycles since the song started
+uint32_t simNextInterrupt;		// Cycle the next timer interrupt lands on
+uint8_t simTimerDivider;		// What the PIT is actually programmed for (only setTimerDivider changes it)
+uint8_t simAuto;				// DIVIDER AUTO on, or a fixed divider
+uint32_t simWorstLateness;
+uint16_t simRaises;
+uint32_t simSettledLateness;	// Worst lateness over the last SIM_SETTLED_SONGS songs of a run
+uint8_t simHighestDivider;		// Biggest divider any song of the last run played at
+char simHistory[SIM_SONGS * 4 + 1];	// Divider after each song of the last run
+uint32_t simSeed;				// Keeps the gaps between bursts the same from run to run
+uint16_t simFailures = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void simSpend(uint32_t cycles);						// Let the main loop use up some cycles, with the interrupt butting in on schedule
+uint16_t simTrueLoad(void);							// What the interrupt really costs at the PIT's divider (tenths of a percent)
+void simPlaySong(void);								// One song, main loop and all
+uint8_t simRun(const simMachine *machine, uint8_t autoDivider, uint8_t divider);	// A whole playlist, returning where the divider ended up
+uint32_t simRandom(uint32_t range);					// Pseudo-random number from 0 to range-1
+void simFail(const char *what);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void simFail(const char *what)
+{
+	printf("FAIL: %s: %s\n", simCurrent->name, what);
+	simFailures++;
+}
+
+uint32_t simRandom(uint32_t range)
+{
+	// Plain old LCG - rand() isn't the same everywhere, and the results should be
+	simSeed = (simSeed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+	return (simSeed >> 16) % range;
+}
+
+void setTimerDivider(uint8_t divider)
+{
+	playbackFrequencyDivider = divider;
+	simTimerDivider = divider;
+	simRaises++;
+}
+
+uint16_t simTrueLoad(void)
+{
+	return (uint16_t)((simCurrent->isrCycles * 1000) / (simCurrent->cyclesPerTick * simTimerDivider));
+}
+
+void simSpend(uint32_t cycles)
+{
+	while (cycles > 0)
+	{
+		if (simNow + cycles < simNextInterrupt)
+		{
+			simNow += cycles;
+			return;
+		}
+		// Up to the interrupt, then the interrupt itself (which moves the clock by the divider it's told, like timerHandler)
+		cycles -= simNextInterrupt - simNow;
+		simNow = simNextInterrupt + simCurrent->isrCycles;
+		simNextInterrupt += simCurrent->cyclesPerTick * simTimerDivider;
+		tickCounter += playbackFrequencyDivider;
+	}
+}
+
+void simPlaySong(void)
+{
+	uint32_t dataCurrentSample = 0;
+	uint32_t burstLeft = simCurrent->burstWrites;
+	uint32_t writesSinceDraw = 0;
+	uint32_t screenStart = 0;
+	uint32_t lateness;
+	uint32_t stageStart;
+	uint32_t processTicks;
+	uint32_t drawTicks;
+	uint32_t barTicks;
+
+	// Same as initPlayback
+	tickCounter = 0;
+	simNow = 0;
+	simNextInterrupt = simCurrent->cyclesPerTick * simTimerDivider;
+	autoDividerResetStats();
+	simSeed = 1;
+
+	while (dataCurrentSample < SIM_SONG_TICKS)
+	{
+		lateness = 0;
+		if (tickCounter > dataCurrentSample)
+		{
+			lateness = tickCounter - dataCurrentSample;
+		}
+		if (lateness > simWorstLateness)
+		{
+			simWorstLateness = lateness;
+		}
+		processTicks = 0;
+		drawTicks = 0;
+		barTicks = 0;
+
+		// processCommands - everything that's due, a burst at a time
+		stageStart = tickCounter;
+		while (dataCurrentSample < tickCounter)
+		{
+			simSpend(simCurrent->writeCycles);
+			writesSinceDraw++;
+			burstLeft--;
+			if (burstLeft == 0)
+			{
+				// Real songs don't land on a perfectly even beat, and if these did, some dividers would line up with it just right (or just wrong) and make a mess of the comparison
+				dataCurrentSample += (simCurrent->burstGap / 2) + simRandom(simCurrent->burstGap);
+				burstLeft = simCurrent->burstWrites;
+			}
+		}
+		processTicks = tickCounter - stageStart;
+
+		// Channel table and bars once per screen refresh
+		if ((tickCounter - screenStart) > VGA_REFRESH_TICKS)
+		{
+			if (writesSinceDraw > 0)
+			{
+				stageStart = tickCounter;
+				simSpend(simCurrent->drawCycles + (simCurrent->drawWriteCycles * writesSinceDraw));
+				drawTicks = tickCounter - stageStart;
+				writesSinceDraw = 0;
+			}
+			stageStart = tickCounter;
+			simSpend(simCurrent->barCycles);
+			barTicks = tickCounter - stageStart;
+			screenStart = tickCounter;
+		}
+		stageStart = tickCounter;
+		simSpend(simCurrent->loopCycles);
+		drawTicks += tickCounter - stageStart;
+
+		if (simAuto == TRUE)
+		{
+			autoDividerPass(lateness, processTicks, drawTicks, barTicks);
+		}
+	}
+}
+
+uint8_t simRun(const simMachine *machine, uint8_t autoDivider, uint8_t divider)
+{
+	uint8_t song;
+	uint8_t songs;
+	uint8_t settledFrom;
+	uint8_t settledDivider = 0;
+	uint32_t settledLateness = 0;
+
+	simCurrent = machine;
+	simAuto = autoDivider;
+	playbackFrequencyDivider = divider;
+	simTimerDivider = divider;
+	simHistory[0] = '\0';
+	simHighestDivider = 0;
+
+	// With a fixed divider every song goes the same, so one is plenty
+	songs = (autoDivider == TRUE) ? SIM_SONGS : 1;
+	settledFrom = (autoDivider == TRUE) ? SIM_SONGS - SIM_SETTLED_SONGS : 0;
+	for (song = 0; song < songs; song++)
+	{
+		// The timer interrupt is only measured once, when it's first started
+		if (song == 0)
+		{
+			autoDividerISRLoad = simTrueLoad();
+			autoDividerISRCost = (uint32_t)autoDividerISRLoad * simTimerDivider;
+		}
+		// Whatever the last song picked has to be what the timer is really running at
+		if (playbackFrequencyDivider != simTimerDivider)
+		{
+			simFail("divider changed without reprogramming the timer");
+			simTimerDivider = playbackFrequencyDivider;
+		}
+		simWorstLateness = 0;
+		simRaises = 0;
+		simPlaySong();
+		// Mid-song raises count too - whatever it ended the song on is the most it got to
+		if (playbackFrequencyDivider > simHighestDivider)
+		{
+			simHighestDivider = playbackFrequencyDivider;
+		}
+		sprintf(simHistory + strlen(simHistory), "%3u", playbackFrequencyDivider);
+
+		if (song >= settledFrom)
+		{
+			if (song == settledFrom)
+			{
+				settledDivider = playbackFrequencyDivider;
+			}
+			else if (playbackFrequencyDivider != settledDivider || (autoDivider == TRUE && simRaises > 0))
+			{
+				settledDivider = 0;
+			}
+			if (simWorstLateness > settledLateness)
+			{
+				settledLateness = simWorstLateness;
+			}
+		}
+		if (autoDivider == TRUE)
+		{
+			autoDividerRetune();
+			// Whatever it measured for the interrupt should still match reality at the new divider (within a percent)
+			if (autoDividerISRLoad + 10 < simTrueLoad() || autoDividerISRLoad > simTrueLoad() + 10)
+			{
+				simFail("interrupt load estimate drifted from the real thing");
+			}
+		}
+	}
+	simSettledLateness = settledLateness;
+	return settledDivider;
+}
+
+int main(void)
+{
+	uint8_t i;
+	uint8_t divider;
+	uint8_t settled;
+	uint8_t onTime;
+	uint32_t leastLate;
+
+	strcpy(settings.logPath, "tautodiv.log");
+	remove(settings.logPath);
+
+	for (i = 0; i < sizeof(simMachines) / sizeof(simMachines[0]); i++)
+	{
+		// Find out what the best fixed divider can do by just trying them: the smallest one that stays on time, and the least late any of them gets
+		onTime = 0;
+		leastLate = 0xFFFFFFFFUL;
+		for (divider = 1; divider <= 64; divider++)
+		{
+			if (simRun(&simMachines[i], FALSE, divider) == 0)
+			{
+				continue;
+			}
+			if (simSettledLateness <= AUTO_DIVIDER_MAX_LATENESS && onTime == 0)
+			{
+				onTime = divider;
+			}
+			if (simSettledLateness < leastLate)
+			{
+				leastLate = simSettledLateness;
+			}
+		}
+
+		settled = simRun(&simMachines[i], TRUE, 1);
+		printf("%-24s dividers by song:%s, late %lu (fixed dividers: ", simMachines[i].name, simHistory, (unsigned long)simSettledLateness);
+		if (onTime != 0)
+		{
+			printf("%u is on time)\n", onTime);
+		}
+		else
+		{
+			printf("none on time, best is %lu late)\n", (unsigned long)leastLate);
+		}
+
+		if (settled == 0)
+		{
+			simFail("divider never settled");
+		}
+		// If some divider can keep up, it has to find one, and not go much higher than it needs to
+		else if (onTime != 0)
+		{
+			if (simSettledLateness > AUTO_DIVIDER_MAX_LATENESS)
+			{
+				simFail("settled divider still plays late");
+			}
+			if (settled > onTime + 1)
+			{
+				simFail("settled on a bigger divider than it needs");
+			}
+		}
+		// If none can, it should get about as close as the best of them, without running off to a huge divider
+		else if (simSettledLateness > leastLate + (leastLate / 4) || settled > 64)
+		{
+			simFail("settled somewhere a lot worse than the best fixed divider");
+		}
+		// Getting there shouldn't mean a song or two stuck way up above it either - timing that coarse is easy to hear
+		if (settled != 0 && simHighestDivider > settled + (settled / 4) + 1)
+		{
+			simFail("overshot the divider it settled on along the way");
+		}
+		if (simMachines[i].expectDivider != 0 && settled > simMachines[i].expectDivider)
+		{
+			simFail("settled on a bigger divider than expected");
+		}
+	}
+	remove(settings.logPath);
+
+	if (simFailures > 0)
+	{
+		printf("TAUTODIV: %u failures\n", simFailures);
+		return 1;
+	}
+	printf("TAUTODIV: OK\n");
+	return 0;
+}
@@ -0,0 +1,284 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TBUS.C - Host test for the OPL bus timing rules (BUS.C)
+//
+// BUS.C gets its time and its ports through busClock, busPortWrite and
+// busPortRead, so this file points them at a pretend PIT channel 2 that
+// counts down a tick every time it's touched, like a real one would while the
+// CPU sat on the bus.  Every port access is logged with the time it happened,
+// and the checks look at the gaps between them.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+
+#include "bus.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// Each time the pretend clock is read or a port is touched, this many PIT ticks go by (about what an ISA bus access costs)
+#define TEST_BUS_STEP 1
+
+// OPL2 gaps in PIT ticks, about what opl.c asks for (3.3us after the register, 23us after the data)
+#define TEST_GAP_REG 4
+#define TEST_GAP_DATA 28
+
+uint16_t testTime = 0;			// The pretend clock - counts down, like the PIT
+uint8_t testClockStuck = FALSE;	// Stop the clock, as if channel 2 never got started
+#define TEST_LOG_SIZE 16
+uint16_t testLogTime[TEST_LOG_SIZE];	// When each port access happened
+uint16_t testLogPort[TEST_LOG_SIZE];
+uint8_t testLogCount = 0;
+uint16_t testFailures = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what);				// Note a failed check
+uint16_t testClock(void);						// The pretend PIT channel 2
+void testPortWrite(uint16_t port, uint8_t data);	// Log a port write
+uint8_t testPortRead(uint16_t port);			// Log a port read
+void testLog(uint16_t port);					// Note the time of a port access
+void testReset(uint16_t startTime);				// Start over with both chips idle
+uint16_t testElapsed(uint8_t from, uint8_t to);	// PIT ticks between two logged accesses
+void testBackToBack(void);						// Writes with nothing in between have to wait out the whole gap
+void testWorkInBetween(void);					// Time spent elsewhere counts towards the gap
+void testWrapAround(void);						// The clock wrapping past 0 doesn't upset anything
+void testTwoChips(void);						// One chip's gap doesn't hold up the other
+void testStuckClock(void);						// A clock that never moves doesn't hang the player
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what)
+{
+	printf("FAIL: %s\n", what);
+	testFailures++;
+}
+
+// BUS.C starts out pointing at the real hardware, which the host doesn't have
+uint16_t busHardwareClock(void)
+{
+	return 0;
+}
+
+void busHardwarePortWrite(uint16_t port, uint8_t data)
+{
+}
+
+uint8_t busHardwarePortRead(uint16_t port)
+{
+	return 0;
+}
+
+uint16_t testClock(void)
+{
+	if (testClockStuck == FALSE)
+	{
+		testTime -= TEST_BUS_STEP;
+	}
+	return testTime;
+}
+
+void testLog(uint16_t port)
+{
+	if (testLogCount < TEST_LOG_SIZE)
+	{
+		testLogTime[testLogCount] = testTime;
+		testLogPort[testLogCount] = port;
+		testLogCount++;
+	}
+	if (testClockStuck == FALSE)
+	{
+		testTime -= TEST_BUS_STEP;
+	}
+}
+
+void testPortWrite(uint16_t port, uint8_t data)
+{
+	testLog(port);
+}
+
+uint8_t testPortRead(uint16_t port)
+{
+	testLog(port);
+	return 0;
+}
+
+void testReset(uint16_t startTime)
+{
+	testTime = startTime;
+	testClockStuck = FALSE;
+	testLogCount = 0;
+	busGap[0] = 0;
+	busGap[1] = 0;
+	busAccesses = 0;
+	busWaits = 0;
+}
+
+uint16_t testElapsed(uint8_t from, uint8_t to)
+{
+	// Counting down, so earlier minus later, and the wrap takes care of itself
+	return (uint16_t)(testLogTime[from] - testLogTime[to]);
+}
+
+void testBackToBack(void)
+{
+	testReset(0x8000);
+	// One register write, the way writeOPL does it
+	busWrite(0, 0x388, 0x20, TEST_GAP_REG);
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	busWrite(0, 0x388, 0x40, TEST_GAP_REG);
+	busRead(0, 0x388);
+	if (testLogCount != 4 || busAccesses != 4)
+	{
+		testFail("back to back: wrong number of port accesses");
+		return;
+	}
+	if (testElapsed(0, 1) < TEST_GAP_REG)
+	{
+		testFail("back to back: data written before the register gap was up");
+	}
+	if (testElapsed(1, 2) < TEST_GAP_DATA)
+	{
+		testFail("back to back: next register written before the data gap was up");
+	}
+	if (testElapsed(2, 3) < TEST_GAP_REG)
+	{
+		testFail("back to back: read before the register gap was up");
+	}
+	// Waiting is fine, but not a lot longer than needed
+	if (testElapsed(1, 2) > TEST_GAP_DATA + 3)
+	{
+		testFail("back to back: waited much longer than the gap");
+	}
+	if (busWaits != 3)
+	{
+		testFail("back to back: every access should have had to wait");
+	}
+}
+
+void testWorkInBetween(void)
+{
+	uint16_t workDone;
+
+	testReset(0x8000);
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	// The player goes off and parses the VGM for longer than the gap
+	testTime -= TEST_GAP_DATA + 10;
+	busWrite(0, 0x388, 0x40, TEST_GAP_REG);
+	if (busWaits != 0)
+	{
+		testFail("work in between: waited even though the gap was already over");
+	}
+	// And for only part of it, so just the rest gets waited out
+	busWrite(0, 0x389, 0x3F, TEST_GAP_DATA);
+	busWaits = 0;
+	testTime -= TEST_GAP_DATA / 2;
+	workDone = testTime;
+	busWrite(0, 0x388, 0x60, TEST_GAP_REG);
+	if (busWaits != 1 || testElapsed(2, 3) < TEST_GAP_DATA)
+	{
+		testFail("work in between: didn't wait out what was left of the gap");
+	}
+	if ((uint16_t)(workDone - testLogTime[3]) > (TEST_GAP_DATA - (TEST_GAP_DATA / 2)) + 2)
+	{
+		testFail("work in between: waited the whole gap instead of what was left");
+	}
+	// A gap is only waited out once - after that the chip is ready whenever
+	busWait(0);
+	testTime -= 1000;
+	busWaits = 0;
+	busWait(0);
+	if (busWaits != 0 || busGap[0] != 0)
+	{
+		testFail("work in between: gap got waited for twice");
+	}
+}
+
+void testWrapAround(void)
+{
+	// Start just above zero so the gap runs past the wrap from 0x0000 to 0xFFFF
+	testReset(TEST_GAP_DATA / 2);
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	busWrite(0, 0x388, 0x40, TEST_GAP_REG);
+	if (testLogTime[1] < 0x8000)
+	{
+		testFail("wrap around: test clock didn't wrap");
+	}
+	if (testElapsed(0, 1) < TEST_GAP_DATA || testElapsed(0, 1) > TEST_GAP_DATA + 3)
+	{
+		testFail("wrap around: gap wrong across the wrap");
+	}
+}
+
+void testTwoChips(void)
+{
+	testReset(0x8000);
+	// Dual OPL2 - the second chip's write shouldn't wait for the first chip's gap
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	busWrite(1, 0x228, 0x20, TEST_GAP_REG);
+	if (busWaits != 0 || testElapsed(0, 1) >= TEST_GAP_DATA)
+	{
+		testFail("two chips: second chip waited for the first one's gap");
+	}
+	// But the first chip still owes the rest of its own
+	busWrite(0, 0x388, 0x40, TEST_GAP_REG);
+	if (testElapsed(0, 2) < TEST_GAP_DATA)
+	{
+		testFail("two chips: first chip's gap got lost");
+	}
+}
+
+void testStuckClock(void)
+{
+	testReset(0x8000);
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	// If the clock never moves, busWait has to give up rather than spin forever
+	testClockStuck = TRUE;
+	busWrite(0, 0x388, 0x40, TEST_GAP_REG);
+	busWrite(0, 0x389, 0x01, TEST_GAP_DATA);
+	if (testLogCount != 3)
+	{
+		testFail("stuck clock: writes didn't go out");
+	}
+	if (busWaits != 2)
+	{
+		testFail("stuck clock: should have counted both waits");
+	}
+}
+
+int main(void)
+{
+	busClock = testClock;
+	busPortWrite = testPortWrite;
+	busPortRead = testPortRead;
+
+	testBackToBack();
+	testWorkInBetween();
+	testWrapAround();
+	testTwoChips();
+	testStuckClock();
+
+	if (testFailures > 0)
+	{
+		printf("TBUS: %u failures\n", testFailures);
+		return 1;
+	}
+	printf("TBUS: OK\n");
+	return 0;
+}
@@ -0,0 +1,613 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TDECODE.C - Host test for the table-driven register decoder (DECODE.C)
+//
+// DECODE.C reads oplRegisterMap and the change queue and writes oplStatus, so
+// this file stands in for those parts of OPL.C.  testOldDecode is the
+// hand-written decoder drawChannelTable had before DECODE.C, with the drawing
+// taken out, working on its own copy of oplStatus.  Known writes to the
+// operator, channel, 4-op (0x104) and rhythm (0xBD) registers are checked
+// against values worked out by hand, and then lots of random ones are checked
+// against the old decoder.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+
+#include "decode.h"
+#include "opl.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// The parts of OPL.C that DECODE.C uses
+char testRegisters[0x200];
+char testChanged[0x200];
+char *oplRegisterMap = testRegisters;
+char *oplChangeMap = testChanged;
+uint16_t far oplChangeQueue[OPL_CHANGE_QUEUE_SIZE];
+volatile uint16_t oplChangeHead = 0;
+volatile uint16_t oplChangeTail = 0;
+uint8_t maxChannels = 18;
+oplChip oplStatus;
+
+// Copied from OPL.C
+const uint8_t oplOperatorToChannel[] = {
+0, 1, 2, 0, 1, 2, 0, 0, 3, 4, 5, 3, 4, 5, 0, 0, 6, 7, 8, 6, 7, 8
+};
+const uint8_t oplOffsetToOperator[] = {
+0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1
+};
+
+// The old decoder's copy of oplStatus, and its own queue, since it re-queued what it wanted another look at
+oplChip testOldStatus;
+#define TEST_OLD_QUEUE_SIZE 0x400
+uint16_t testOldQueue[TEST_OLD_QUEUE_SIZE];
+uint16_t testOldQueueCount = 0;
+
+#define TEST_ROUNDS 4000
+uint32_t testRandomState = 1;
+uint16_t testFailures = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what);				// Note a failed check
+uint16_t testRandom(uint16_t range);			// Repeatable random number from 0 up to (not including) range
+void testReset(uint8_t channels);				// Clear both decoders, the registers and the queue, for an OPL2 (9) or OPL3 (18)
+void testWrite(uint16_t reg, uint8_t value);	// Write a register, queueing it the way markOPLChanged does
+void testDecode(void);							// Run both decoders over everything queued
+void testOldDecode(uint16_t i);					// What drawChannelTable used to do with one changed register, minus the drawing
+void testOldQueueRegister(uint16_t i);			// markOPLChanged, for the old decoder
+uint8_t testCompare(const char *what);			// oplStatus is what the old decoder made of the same writes - returns FALSE if not
+void testOperator(void);						// 0x20-0x95 and 0xE0-0xF5, both banks
+void testChannel(void);							// 0xA0-0xC8
+void testFourOp(void);							// 0x104
+void testRhythm(void);							// 0xBD
+void testRandomWrites(void);					// Lots of random writes, checked against the old decoder all along the way
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what)
+{
+	printf("FAIL: %s\n", what);
+	testFailures++;
+}
+
+uint16_t testRandom(uint16_t range)
+{
+	// Plain LCG - the same every run, so a failure can be chased down
+	testRandomState = testRandomState * 1103515245 + 12345;
+	return (uint16_t)((testRandomState >> 16) % range);
+}
+
+void testReset(uint8_t channels)
+{
+	memset(&oplStatus, 0, sizeof(oplStatus));
+	memset(&testOldStatus, 0, sizeof(testOldStatus));
+	memset(testRegisters, 0, sizeof(testRegisters));
+	memset(testChanged, 0, sizeof(testChanged));
+	memset(decodeChannelChanges, 0, sizeof(decodeChannelChanges));
+	oplChangeHead = 0;
+	oplChangeTail = 0;
+	testOldQueueCount = 0;
+	decodeChangedCount = 0;
+	decodeGlobalChanges = 0;
+	maxChannels = channels;
+}
+
+void testWrite(uint16_t reg, uint8_t value)
+{
+	testRegisters[reg] = (char)value;
+	if (oplChangeMap[reg] == 0)
+	{
+		oplChangeMap[reg] = 1;
+		oplChangeQueue[oplChangeTail] = reg;
+		oplChangeTail = (oplChangeTail + 1) & (OPL_CHANGE_QUEUE_SIZE - 1);
+		testOldQueueRegister(reg);
+	}
+}
+
+void testOldQueueRegister(uint16_t i)
+{
+	if (testOldQueueCount < TEST_OLD_QUEUE_SIZE)
+	{
+		testOldQueue[testOldQueueCount] = i;
+		testOldQueueCount++;
+	}
+}
+
+void testDecode(void)
+{
+	uint16_t i;
+
+	// The old decoder's re-queued registers go on the end, so the loop picks them up too
+	for (i = 0; i < testOldQueueCount; i++)
+	{
+		testOldDecode(testOldQueue[i]);
+	}
+	testOldQueueCount = 0;
+	decodeOPLChanges();
+}
+
+void testOldDecode(uint16_t i)
+{
+	uint16_t displayRegisterMax = (maxChannels > 9) ? 0x1FF : 0xFF;
+	uint8_t targetChannel = 0;
+	uint8_t targetOperator = 0;
+	uint8_t j;
+	uint8_t value = (uint8_t)testRegisters[i];
+	oplChip *status = &testOldStatus;
+
+	if (i < 0x20 || i > displayRegisterMax)
+	{
+		return;
+	}
+	// Tremolo / Vibrato / Sustain / KSR Flags & Multiplier
+	if ((i >= 0x20 && i <= 0x35) || (i >= 0x120 && i <= 0x135))
+	{
+		targetChannel = oplOperatorToChannel[(i & 0xFF) - 0x20] + ((i >> 8) * 9);
+		targetOperator = oplOffsetToOperator[(i & 0xFF) - 0x20];
+		status->channels[targetChannel].operators[targetOperator].frequencyMultiplierFactor = (value & 0x0F);
+		status->channels[targetChannel].operators[targetOperator].flagTremolo = ((value >> 7) & 0x01);
+		status->channels[targetChannel].operators[targetOperator].flagFrequencyVibrato = ((value >> 6) & 0x01);
+		status->channels[targetChannel].operators[targetOperator].flagSoundSustaining = ((value >> 5) & 0x01);
+		status->channels[targetChannel].operators[targetOperator].flagKSR = ((value >> 4) & 0x01);
+	}
+	// Key Scaling Level / Output Level
+	else if ((i >= 0x40 && i <= 0x55) || (i >= 0x140 && i <= 0x155))
+	{
+		targetChannel = oplOperatorToChannel[(i & 0xFF) - 0x40] + ((i >> 8) * 9);
+		targetOperator = oplOffsetToOperator[(i & 0xFF) - 0x40];
+		status->channels[targetChannel].operators[targetOperator].keyScaleLevel = (value >> 6);
+		status->channels[targetChannel].operators[targetOperator].outputLevel = (value & 0x3F);
+	}
+	// Attack Rate / Decay Rate
+	else if ((i >= 0x60 && i <= 0x75) || (i >= 0x160 && i <= 0x175))
+	{
+		targetChannel = oplOperatorToChannel[(i & 0xFF) - 0x60] + ((i >> 8) * 9);
+		targetOperator = oplOffsetToOperator[(i & 0xFF) - 0x60];
+		status->channels[targetChannel].operators[targetOperator].attackRate = (value >> 4);
+		status->channels[targetChannel].operators[targetOperator].decayRate = (value & 0x0F);
+	}
+	// Sustain Level / Release Rate
+	else if ((i >= 0x80 && i <= 0x95) || (i >= 0x180 && i <= 0x195))
+	{
+		targetChannel = oplOperatorToChannel[(i & 0xFF) - 0x80] + ((i >> 8) * 9);
+		targetOperator = oplOffsetToOperator[(i & 0xFF) - 0x80];
+		status->channels[targetChannel].operators[targetOperator].sustainLevel = (value >> 4);
+		status->channels[targetChannel].operators[targetOperator].releaseRate = (value & 0x0F);
+	}
+	// Frequency (Low)
+	else if ((i >= 0xA0 && i <= 0xA8) || (i >= 0x1A0 && i <= 0x1A8))
+	{
+		targetChannel = ((i & 0xFF) - 0xA0) + ((i >> 8) * 9);
+		status->channels[targetChannel].frequencyNumber = (uint8_t)testRegisters[i] + (((uint8_t)testRegisters[i + 0x10] & 0x03) << 8);
+	}
+	// Frequency (High) / Block / Key on
+	else if ((i >= 0xB0 && i <= 0xB8) || (i >= 0x1B0 && i <= 0x1B8))
+	{
+		targetChannel = ((i & 0xFF) - 0xB0) + ((i >> 8) * 9);
+		status->channels[targetChannel].frequencyNumber = (uint8_t)testRegisters[i - 0x10] + ((value & 0x03) << 8);
+		status->channels[targetChannel].blockNumber = ((value >> 2) & 0x07);
+		// Don't actually use the keyOn value for channels 7-9 if percussion mode is activated
+		if (targetChannel >= 6 && targetChannel <= 8)
+		{
+			if (status->flagPercussionMode == FALSE)
+			{
+				status->channels[targetChannel].keyOn = ((value >> 5) & 0x01);
+			}
+		}
+		else
+		{
+			status->channels[targetChannel].keyOn = ((value >> 5) & 0x01);
+		}
+	}
+	// Tremolo Depth / Vibrato Depth / Percussion Mode
+	else if (i == 0xBD)
+	{
+		// The old one only did percussion mode - the depths were added with DECODE.C
+		status->tremoloDepth = (value >> 7) & 0x01;
+		status->frequencyVibratoDepth = (value >> 6) & 0x01;
+		status->flagPercussionMode = (value >> 5) & 0x01;
+		status->percussionData = value & 0x1F;
+		status->channels[6].keyOn = (status->percussionData >> 4) & 0x01;
+		status->channels[7].keyOn = ((status->percussionData >> 3) & 0x01) | (status->percussionData & 0x01);
+		status->channels[8].keyOn = ((status->percussionData >> 2) & 0x01) | ((status->percussionData >> 1) & 0x01);
+		testOldQueueRegister(0xB6);
+		testOldQueueRegister(0xB7);
+		testOldQueueRegister(0xB8);
+	}
+	// Panning, Feedback, Algorithm
+	else if ((i >= 0xC0 && i <= 0xC8) || (i >= 0x1C0 && i <= 0x1C8))
+	{
+		targetChannel = ((i & 0xFF) - 0xC0) + ((i >> 8) * 9);
+		status->channels[targetChannel].panning = ((value >> 4) & 0x03);
+		status->channels[targetChannel].synthesisType = (value & 0x01);
+		status->channels[targetChannel].feedback = ((value >> 1) & 0x07);
+	}
+	// Waveform Select
+	else if ((i >= 0xE0 && i <= 0xF5) || (i >= 0x1E0 && i <= 0x1F5))
+	{
+		targetChannel = oplOperatorToChannel[(i & 0xFF) - 0xE0] + ((i >> 8) * 9);
+		targetOperator = oplOffsetToOperator[(i & 0xFF) - 0xE0];
+		// If OPL2, ignore the highest bit as those waveforms can't be used
+		if (status->flagOPL3Mode == 0)
+		{
+			status->channels[targetChannel].operators[targetOperator].waveform = (value & 0x03);
+		}
+		else
+		{
+			status->channels[targetChannel].operators[targetOperator].waveform = (value & 0x07);
+		}
+	}
+	// OPL3 4-op flags
+	else if (i == 0x104)
+	{
+		status->channels[0].flag4Op = (value & 0x01);
+		status->channels[3].flag4Op = (value & 0x01);
+		status->channels[1].flag4Op = (value & 0x02) >> 1;
+		status->channels[4].flag4Op = (value & 0x02) >> 1;
+		status->channels[2].flag4Op = (value & 0x04) >> 2;
+		status->channels[5].flag4Op = (value & 0x04) >> 2;
+		status->channels[9].flag4Op = (value & 0x08) >> 3;
+		status->channels[12].flag4Op = (value & 0x08) >> 3;
+		status->channels[10].flag4Op = (value & 0x10) >> 4;
+		status->channels[13].flag4Op = (value & 0x10) >> 4;
+		status->channels[11].flag4Op = (value & 0x20) >> 5;
+		status->channels[14].flag4Op = (value & 0x20) >> 5;
+	}
+	// OPL3 "new bit"
+	else if (i == 0x105)
+	{
+		status->flagOPL3Mode = (value & 0x01);
+		// Waveforms 4-7 only exist in OPL3 mode, so those need another look too
+		for (j = 0x00; j <= 0x15; j++)
+		{
+			if ((j & 0x07) < 0x06)
+			{
+				testOldQueueRegister(0xE0 + j);
+				testOldQueueRegister(0x1E0 + j);
+			}
+		}
+	}
+}
+
+uint8_t testCompare(const char *what)
+{
+	uint8_t channel;
+	uint8_t op;
+	oplChannel *now;
+	oplChannel *old;
+
+	for (channel = 0; channel < 18; channel++)
+	{
+		now = &oplStatus.channels[channel];
+		old = &testOldStatus.channels[channel];
+		for (op = 0; op < 2; op++)
+		{
+			if (memcmp(&now->operators[op], &old->operators[op], sizeof(oplOperator)) != 0)
+			{
+				printf("      channel %u operator %u\n", channel, op);
+				testFail(what);
+				return FALSE;
+			}
+		}
+		if (now->frequencyNumber != old->frequencyNumber || now->blockNumber != old->blockNumber || now->keyOn != old->keyOn ||
+			now->flag4Op != old->flag4Op || now->panning != old->panning || now->feedback != old->feedback || now->synthesisType != old->synthesisType)
+		{
+			printf("      channel %u\n", channel);
+			testFail(what);
+			return FALSE;
+		}
+	}
+	if (oplStatus.flagOPL3Mode != testOldStatus.flagOPL3Mode || oplStatus.flagPercussionMode != testOldStatus.flagPercussionMode ||
+		oplStatus.percussionData != testOldStatus.percussionData || oplStatus.tremoloDepth != testOldStatus.tremoloDepth ||
+		oplStatus.frequencyVibratoDepth != testOldStatus.frequencyVibratoDepth)
+	{
+		testFail(what);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+void testOperator(void)
+{
+	oplOperator *op;
+
+	testReset(18);
+	// 0x2D is offset 0x0D, the second operator of channel 6
+	testWrite(0x2D, 0xE5);
+	testWrite(0x4D, 0x9A);
+	testWrite(0x6D, 0xC3);
+	testWrite(0x8D, 0x7E);
+	testWrite(0xED, 0x06);
+	testDecode();
+	op = &oplStatus.channels[5].operators[1];
+	if (op->flagTremolo != 1 || op->flagFrequencyVibrato != 1 || op->flagSoundSustaining != 1 || op->flagKSR != 0 || op->frequencyMultiplierFactor != 5 ||
+		op->keyScaleLevel != 2 || op->outputLevel != 0x1A || op->attackRate != 0xC || op->decayRate != 3 ||
+		op->sustainLevel != 7 || op->releaseRate != 0xE)
+	{
+		testFail("operator: fields of channel 6's second operator wrong");
+	}
+	// OPL3 mode isn't on, so waveform 6 is really 2
+	if (op->waveform != 2)
+	{
+		testFail("operator: OPL2 waveform kept its top bit");
+	}
+	if (decodeChangedCount != 1 || decodeChangedChannels[0] != 5 ||
+		decodeChannelChanges[5] != ((DECODE_OP1_FLAGS | DECODE_OP1_LEVEL | DECODE_OP1_ATTACK | DECODE_OP1_SUSTAIN | DECODE_OP1_WAVEFORM) << DECODE_OP2_SHIFT))
+	{
+		testFail("operator: changes not marked as channel 6's second operator");
+	}
+	testCompare("operator: doesn't match the old decoder");
+
+	// 0x150 is offset 0x10 of the second bank, the first operator of channel 16
+	testWrite(0x150, 0x7F);
+	testWrite(0x1F0, 0x05);
+	testWrite(0x105, 0x01);
+	testDecode();
+	op = &oplStatus.channels[15].operators[0];
+	if (op->keyScaleLevel != 1 || op->outputLevel != 0x3F || op->waveform != 5)
+	{
+		testFail("operator: second bank operator wrong");
+	}
+	// Turning OPL3 mode on brings back the top bit of the waveform written before it
+	if (oplStatus.channels[5].operators[1].waveform != 6)
+	{
+		testFail("operator: OPL3 mode didn't bring back waveforms 4-7");
+	}
+	testCompare("operator: second bank doesn't match the old decoder");
+
+	// The gaps between the operator groups don't belong to anyone.  The old decoder put these into channel 1.
+	testReset(18);
+	testWrite(0x26, 0xFF);
+	testWrite(0x4F, 0xFF);
+	testWrite(0x1EE, 0xFF);
+	decodeOPLChanges();
+	if (oplStatus.channels[0].operators[0].flagTremolo != 0 || oplStatus.channels[0].operators[0].outputLevel != 0 || decodeChangedCount != 0)
+	{
+		testFail("operator: write to an operator gap landed in a channel");
+	}
+
+	// An OPL2 has no second bank
+	testReset(9);
+	testWrite(0x120, 0xFF);
+	testDecode();
+	if (oplStatus.channels[9].operators[0].flagTremolo != 0)
+	{
+		testFail("operator: OPL2 decoded a second bank register");
+	}
+	testCompare("operator: OPL2 doesn't match the old decoder");
+}
+
+void testChannel(void)
+{
+	oplChannel *channel;
+
+	testReset(18);
+	// Channel 4: frequency 0x241, block 4, keyed on, both speakers, feedback 5, additive
+	testWrite(0xA3, 0x41);
+	testWrite(0xB3, 0x32);
+	testWrite(0xC3, 0x3B);
+	testDecode();
+	channel = &oplStatus.channels[3];
+	if (channel->frequencyNumber != 0x241 || channel->blockNumber != 4 || channel->keyOn != 1)
+	{
+		testFail("channel: frequency, block or key-on wrong");
+	}
+	if (channel->panning != 3 || channel->feedback != 5 || channel->synthesisType != 1)
+	{
+		testFail("channel: panning, feedback or algorithm wrong");
+	}
+	if (decodeChannelChanges[3] != (DECODE_FREQUENCY | DECODE_KEY | DECODE_ALGORITHM))
+	{
+		testFail("channel: changes not marked");
+	}
+	testCompare("channel: doesn't match the old decoder");
+
+	// Just the low byte changes - the high bits from 0xB3 still count
+	testWrite(0xA3, 0x10);
+	testDecode();
+	if (channel->frequencyNumber != 0x210)
+	{
+		testFail("channel: low frequency byte lost the high bits");
+	}
+	// And the same on the second bank, key off
+	testWrite(0x1A8, 0xFF);
+	testWrite(0x1B8, 0x0F);
+	testWrite(0x1C8, 0x20);
+	testDecode();
+	channel = &oplStatus.channels[17];
+	if (channel->frequencyNumber != 0x3FF || channel->blockNumber != 3 || channel->keyOn != 0 || channel->panning != 2)
+	{
+		testFail("channel: second bank channel wrong");
+	}
+	testCompare("channel: second bank doesn't match the old decoder");
+}
+
+void testFourOp(void)
+{
+	uint8_t channel;
+	// 0x15 pairs up channels 1+4, 3+6 and 11+14
+	uint8_t expected[18] = {1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0};
+
+	testReset(18);
+	testWrite(0x104, 0x15);
+	testDecode();
+	for (channel = 0; channel < 18; channel++)
+	{
+		if (oplStatus.channels[channel].flag4Op != expected[channel])
+		{
+			printf("      channel %u\n", channel);
+			testFail("4-op: pairing flags wrong");
+			break;
+		}
+	}
+	if ((decodeGlobalChanges & DECODE_GLOBAL_4OP) == 0)
+	{
+		testFail("4-op: change not marked");
+	}
+	testCompare("4-op: doesn't match the old decoder");
+
+	// Then all of them, then none
+	testWrite(0x104, 0x3F);
+	testDecode();
+	if (oplStatus.channels[14].flag4Op != 1 || oplStatus.channels[11].flag4Op != 1 || oplStatus.channels[6].flag4Op != 0)
+	{
+		testFail("4-op: all pairs on wrong");
+	}
+	testCompare("4-op: all pairs doesn't match the old decoder");
+	testWrite(0x104, 0x00);
+	testDecode();
+	testCompare("4-op: no pairs doesn't match the old decoder");
+
+	// An OPL2 doesn't have 0x104
+	testReset(9);
+	testWrite(0x104, 0x3F);
+	testDecode();
+	if (oplStatus.channels[0].flag4Op != 0 || decodeGlobalChanges != 0)
+	{
+		testFail("4-op: OPL2 decoded 0x104");
+	}
+	testCompare("4-op: OPL2 doesn't match the old decoder");
+}
+
+void testRhythm(void)
+{
+	testReset(9);
+	// Channel 8 keyed on by itself first
+	testWrite(0xB7, 0x20);
+	testDecode();
+	// Percussion mode, bass drum and hi-hat, and both depths
+	testWrite(0xBD, 0xF1);
+	testDecode();
+	if (oplStatus.flagPercussionMode != 1 || oplStatus.percussionData != 0x11 || oplStatus.tremoloDepth != 1 || oplStatus.frequencyVibratoDepth != 1)
+	{
+		testFail("rhythm: 0xBD fields wrong");
+	}
+	if (oplStatus.channels[6].keyOn != 1 || oplStatus.channels[7].keyOn != 1 || oplStatus.channels[8].keyOn != 0)
+	{
+		testFail("rhythm: drums didn't key channels 7-9");
+	}
+	if ((decodeGlobalChanges & DECODE_GLOBAL_RHYTHM) == 0)
+	{
+		testFail("rhythm: change not marked");
+	}
+	testCompare("rhythm: doesn't match the old decoder");
+
+	// While percussion mode is on, channel 8's own key-off doesn't count
+	testWrite(0xB7, 0x00);
+	testWrite(0xB8, 0x20);
+	testDecode();
+	if (oplStatus.channels[7].keyOn != 1 || oplStatus.channels[8].keyOn != 0)
+	{
+		testFail("rhythm: channels 8-9 went by their own key-on in percussion mode");
+	}
+	testCompare("rhythm: key-on in percussion mode doesn't match the old decoder");
+
+	// Percussion mode off, and channels 7-9 go back to their own key-ons
+	testWrite(0xBD, 0x00);
+	testDecode();
+	if (oplStatus.flagPercussionMode != 0 || oplStatus.channels[6].keyOn != 0 || oplStatus.channels[7].keyOn != 0 || oplStatus.channels[8].keyOn != 1)
+	{
+		testFail("rhythm: channels 7-9 didn't go back to their own key-ons");
+	}
+	testCompare("rhythm: percussion mode off doesn't match the old decoder");
+}
+
+void testRandomWrites(void)
+{
+	uint32_t round;
+	uint16_t reg;
+	uint16_t writes;
+	uint8_t offset;
+
+	testReset(18);
+	testRandomState = 1;
+	for (round = 0; round < TEST_ROUNDS; round++)
+	{
+		// Sometimes an OPL2 song
+		if (round % 1000 == 0)
+		{
+			testReset((round % 2000 == 0) ? 18 : 9);
+		}
+		writes = 1 + testRandom(40);
+		while (writes > 0)
+		{
+			switch (testRandom(8))
+			{
+				case 0:
+					reg = 0xBD;
+					break;
+				case 1:
+					reg = 0x104 + testRandom(2);
+					break;
+				case 2:
+				case 3:
+					reg = 0xA0 + (testRandom(3) * 0x10) + testRandom(9);
+					break;
+				default:
+					// Operators, leaving out the gaps, which the old decoder got wrong
+					do
+					{
+						offset = (uint8_t)testRandom(0x16);
+					} while ((offset & 0x07) >= 0x06);
+					reg = (0x20 * (1 + testRandom(4))) + offset;
+					if (testRandom(5) == 0)
+					{
+						reg = 0xE0 + offset;
+					}
+					break;
+			}
+			if (testRandom(2) == 0 && reg != 0xBD)
+			{
+				reg += 0x100;
+			}
+			testWrite(reg, (uint8_t)testRandom(0x100));
+			writes--;
+		}
+		testDecode();
+		if (testCompare("random: doesn't match the old decoder") == FALSE)
+		{
+			printf("      round %lu\n", (unsigned long)round);
+			return;
+		}
+		// Nothing is drawing these, so just start them over
+		memset(decodeChannelChanges, 0, sizeof(decodeChannelChanges));
+		decodeChangedCount = 0;
+		decodeGlobalChanges = 0;
+	}
+}
+
+int main(void)
+{
+	testOperator();
+	testChannel();
+	testFourOp();
+	testRhythm();
+	testRandomWrites();
+
+	if (testFailures > 0)
+	{
+		printf("TDECODE: %u failures\n", testFailures);
+		return 1;
+	}
+	printf("TDECODE: OK\n");
+	return 0;
+}
@@ -0,0 +1,244 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TFIFO.C - Host test for the ISR write mode event queue (FIFO.C)
+//
+// FIFO.C only talks to the outside world through writeOPL, tickCounter and
+// oplWriteLock, so this file stands in for all three.  A pretend timer
+// interrupt advances tickCounter and calls drainEventQueue, while a pretend
+// main loop decodes a made-up song into the queue the way fillEventQueue
+// does, getting interrupted at random points along the way.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fifo.h"
+#include "opl.h"
+#include "timer.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// The parts of OPL.C and TIMER.C that FIFO.C uses
+volatile uint32_t tickCounter = 0;
+volatile uint8_t oplWriteLock = 0;
+
+// The made-up song
+#define TEST_EVENTS 20000
+oplEvent testSong[TEST_EVENTS];
+uint16_t testPushed = 0;		// How many of testSong the main loop has queued
+uint16_t testWritten = 0;		// How many of them writeOPL has seen
+uint16_t testTickWrites = 0;	// Writes during the current pretend interrupt
+uint16_t testFailures = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what);		// Note a failed check
+void testMakeSong(void);				// Fill testSong with writes, including bursts bigger than the ISR budget
+void testInterrupt(uint8_t divider);	// One pretend timer tick
+void testMainLoop(void);				// One pretend pass of fillEventQueue
+void testPlaySong(void);				// Run the two against each other until the song is done
+void testLockAndFull(void);				// The write lock and a full queue
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what)
+{
+	printf("FAIL: %s (write %u, tick %lu)\n", what, testWritten, (unsigned long)tickCounter);
+	testFailures++;
+}
+
+void writeOPL(uint16_t reg, uint8_t data)
+{
+	oplEvent *expected = &testSong[testWritten];
+
+	// Every write has to come out once, in order, and not before the timer has passed its sample
+	if (testWritten >= testPushed)
+	{
+		testFail("write that was never queued");
+		return;
+	}
+	if (reg != expected->reg || data != expected->data)
+	{
+		testFail("write out of order");
+	}
+	if (expected->sample >= tickCounter)
+	{
+		testFail("write sent before it was due");
+	}
+	testWritten++;
+	testTickWrites++;
+}
+
+void testMakeSong(void)
+{
+	uint32_t sample = 100;
+	uint16_t i;
+
+	srand(1);
+	for (i = 0; i < TEST_EVENTS; i++)
+	{
+		// Mostly small gaps, with runs of writes on the same sample (a whole instrument being set up at once)
+		if ((rand() % 8) == 0)
+		{
+			sample += rand() % 100;
+		}
+		testSong[i].sample = sample;
+		testSong[i].reg = (uint16_t)(rand() % 0x200);
+		testSong[i].data = (uint8_t)rand();
+	}
+}
+
+void testInterrupt(uint8_t divider)
+{
+	// Same order as timerHandler - the clock moves, then the queue gets drained
+	tickCounter += divider;
+	testTickWrites = 0;
+	if (eventQueueActive)
+	{
+		drainEventQueue();
+	}
+	if (testTickWrites > EVENT_QUEUE_ISR_BUDGET)
+	{
+		testFail("more writes in one tick than the budget allows");
+	}
+}
+
+void testMainLoop(void)
+{
+	// fillEventQueue without the VGM - stay EVENT_QUEUE_LOOKAHEAD ahead of the timer, and stop when the queue fills
+	while (testPushed < TEST_EVENTS && testSong[testPushed].sample < (tickCounter + EVENT_QUEUE_LOOKAHEAD))
+	{
+		if (pushEvent(testSong[testPushed].sample, testSong[testPushed].reg, testSong[testPushed].data) != 0)
+		{
+			if (!eventQueueFull())
+			{
+				testFail("push refused with room in the queue");
+			}
+			break;
+		}
+		testPushed++;
+		// The interrupt can land between any two pushes
+		if ((rand() % 8) == 0)
+		{
+			testInterrupt(1);
+		}
+	}
+}
+
+void testPlaySong(void)
+{
+	uint32_t ticks = 0;
+	uint8_t divider;
+
+	resetEventQueue();
+	eventQueueActive = TRUE;
+	while (testWritten < TEST_EVENTS)
+	{
+		testMainLoop();
+		// A slow main loop pass (screen drawing) lets a few ticks by, at whatever divider the player is on
+		divider = (uint8_t)(1 + (rand() % 4));
+		do
+		{
+			testInterrupt(divider);
+			ticks++;
+		} while ((rand() % 3) != 0);
+
+		if (ticks > 100000000UL)
+		{
+			testFail("song never finished");
+			return;
+		}
+	}
+	if (!eventQueueEmpty())
+	{
+		testFail("queue not empty at the end of the song");
+	}
+	if (eventQueueBudgetOverruns == 0)
+	{
+		testFail("bursts never hit the per-tick budget");
+	}
+}
+
+void testLockAndFull(void)
+{
+	uint16_t i;
+	uint16_t deferrals;
+	uint16_t stalls;
+
+	// Fill the queue right up with writes that are already due
+	resetEventQueue();
+	testSong[0].sample = 0;
+	testSong[0].reg = 0x20;
+	testSong[0].data = 0x01;
+	testPushed = 0;
+	testWritten = 0;
+	tickCounter = 10;
+	for (i = 0; i < EVENT_QUEUE_SIZE - 1; i++)
+	{
+		testSong[i] = testSong[0];
+		if (pushEvent(0, 0x20, 0x01) != 0)
+		{
+			testFail("queue full too early");
+		}
+		testPushed++;
+	}
+	stalls = eventQueueFullStalls;
+	if (pushEvent(0, 0x20, 0x01) == 0 || eventQueueFullStalls != stalls + 1)
+	{
+		testFail("full queue took another write");
+	}
+
+	// With the main loop in the middle of its own write, the interrupt has to leave the ports alone
+	eventQueueActive = TRUE;
+	deferrals = eventQueueLockDeferrals;
+	oplWriteLock = 1;
+	testInterrupt(1);
+	oplWriteLock = 0;
+	if (testWritten != 0 || eventQueueLockDeferrals != deferrals + 1)
+	{
+		testFail("interrupt wrote while the lock was held");
+	}
+
+	// And once it's let go, the queue drains a budget at a time
+	while (!eventQueueEmpty())
+	{
+		testInterrupt(1);
+	}
+	if (testWritten != EVENT_QUEUE_SIZE - 1)
+	{
+		testFail("queue didn't drain after the lock was released");
+	}
+}
+
+int main(void)
+{
+	testMakeSong();
+	testPlaySong();
+	printf("Event queue: %u writes, %u budget overruns, %u queue-full stalls\n", testWritten, eventQueueBudgetOverruns, eventQueueFullStalls);
+	testLockAndFull();
+
+	if (testFailures > 0)
+	{
+		printf("TFIFO: %u failures\n", testFailures);
+		return 1;
+	}
+	printf("TFIFO: OK\n");
+	return 0;
+}
@@ -0,0 +1,380 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TTEXT.C - Host test for the text back buffer and its dirty spans (TXTMODE.C)
+//
+// flushTextScreen takes any 80 column buffer, so the "screen" here is just an
+// array in regular memory.  The checks draw overlapping strings, cells and
+// characters, then look at exactly which cells the flush copied, that the
+// spans start over afterwards, and that a screen that only ever got the
+// flushed spans ends up the same as one that got the whole back buffer.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <string.h>
+
+#include "txtgfx.h"
+#include "txtmode.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+// Anything the flush didn't touch still has this in it
+#define TEST_UNTOUCHED 0xDEAD
+
+#define TEST_CELLS (80*TEXT_MAX_ROWS)
+#define TEST_FRAMES 500
+
+uint16_t testScreen[TEST_CELLS];	// Gets only what flushTextScreen sends
+uint16_t testModel[TEST_CELLS];		// What the screen should look like, worked out separately from TXTMODE.C
+uint8_t testStart[TEXT_MAX_ROWS];	// The spans the test expects, worked out the same way
+uint8_t testEnd[TEXT_MAX_ROWS];
+uint32_t testRandomState = 1;
+uint16_t testFailures = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what);				// Note a failed check
+uint16_t testRandom(uint16_t range);			// Repeatable random number from 0 up to (not including) range
+void testReset(void);							// Blank back buffer and model, nothing dirty, screen full of TEST_UNTOUCHED
+uint16_t testCell(char text, uint8_t foregroundColor, uint8_t backgroundColor);	// Put a cell together the way the screen wants it
+void testModelCells(const uint16_t *cells, uint8_t count, uint8_t xPos, uint8_t yPos);	// Apply a draw to the model, widening the expected span for anything that changed
+void testModelString(char *text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor);	// Same, for a string
+void testSpansMatch(const char *what);			// The back buffer's spans are the ones the test expects
+void testOverlapping(void);						// Overlapping draws on one row copy one span, and nothing else
+void testSpansReset(void);						// A flush leaves nothing waiting, so a second one copies nothing
+void testFullRedraw(void);						// Lots of frames of flushed spans come out the same as copying everything
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void testFail(const char *what)
+{
+	printf("FAIL: %s\n", what);
+	testFailures++;
+}
+
+uint16_t testRandom(uint16_t range)
+{
+	// Plain LCG - the same every run, so a failure can be chased down
+	testRandomState = testRandomState * 1103515245 + 12345;
+	return (uint16_t)((testRandomState >> 16) % range);
+}
+
+void testReset(void)
+{
+	uint16_t i;
+	uint8_t row;
+
+	resetTextBuffer();
+	textRows = TEXT_MAX_ROWS;
+	textCellsFlushed = 0;
+	for (i = 0; i < TEST_CELLS; i++)
+	{
+		testScreen[i] = TEST_UNTOUCHED;
+		testModel[i] = TEXT_BLANK_CELL;
+	}
+	for (row = 0; row < TEXT_MAX_ROWS; row++)
+	{
+		testStart[row] = TEXT_ROW_CLEAN;
+		testEnd[row] = 0;
+	}
+}
+
+uint16_t testCell(char text, uint8_t foregroundColor, uint8_t backgroundColor)
+{
+	return (uint8_t)text | ((uint16_t)(foregroundColor | (backgroundColor << 4)) << 8);
+}
+
+void testModelCells(const uint16_t *cells, uint8_t count, uint8_t xPos, uint8_t yPos)
+{
+	uint16_t cell = cellCoordinate(xPos, yPos);
+
+	while (count > 0)
+	{
+		if (testModel[cell] != *cells)
+		{
+			testModel[cell] = *cells;
+			if (testStart[yPos] == TEXT_ROW_CLEAN || xPos < testStart[yPos])
+			{
+				testStart[yPos] = xPos;
+			}
+			if (xPos + 1 > testEnd[yPos])
+			{
+				testEnd[yPos] = xPos + 1;
+			}
+		}
+		cell++;
+		cells++;
+		xPos++;
+		count--;
+	}
+}
+
+void testModelString(char *text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor)
+{
+	uint16_t cells[80];
+	uint8_t count = 0;
+
+	while (text[count])
+	{
+		cells[count] = testCell(text[count], foregroundColor, backgroundColor);
+		count++;
+	}
+	testModelCells(cells, count, xPos, yPos);
+}
+
+void testSpansMatch(const char *what)
+{
+	uint8_t row;
+
+	for (row = 0; row < TEXT_MAX_ROWS; row++)
+	{
+		if (textDirtyStart[row] != testStart[row] || (testStart[row] != TEXT_ROW_CLEAN && textDirtyEnd[row] != testEnd[row]))
+		{
+			printf("      row %u: span %u-%u, expected %u-%u\n", row, textDirtyStart[row], textDirtyEnd[row], testStart[row], testEnd[row]);
+			testFail(what);
+			return;
+		}
+	}
+}
+
+void testOverlapping(void)
+{
+	uint16_t cells[6];
+	uint16_t i;
+	uint8_t x;
+
+	testReset();
+	// A string, then cells over the back half of it, then a character further along the same row
+	drawStringAtPosition("HELLO WORLD", 10, 3, COLOR_WHITE, COLOR_BLUE);
+	testModelString("HELLO WORLD", 10, 3, COLOR_WHITE, COLOR_BLUE);
+	for (i = 0; i < 6; i++)
+	{
+		cells[i] = testCell((char)('a' + i), COLOR_YELLOW, COLOR_BLACK);
+	}
+	drawCellsAtPosition(cells, 6, 16, 3);
+	testModelCells(cells, 6, 16, 3);
+	drawCharacterAtPosition('!', 40, 3, COLOR_RED, COLOR_BLACK);
+	testModelString("!", 40, 3, COLOR_RED, COLOR_BLACK);
+	// Drawing the same thing again over the top of itself doesn't change anything, so it can't widen anything
+	drawStringAtPosition("WOR", 16, 3, COLOR_WHITE, COLOR_BLUE);
+	testModelString("WOR", 16, 3, COLOR_WHITE, COLOR_BLUE);
+	drawCellsAtPosition(&cells[3], 3, 19, 3);
+	testModelCells(&cells[3], 3, 19, 3);
+	// And a row where the later string starts before the earlier one
+	drawStringAtPosition("XYZ", 70, 20, COLOR_GREEN, COLOR_BLACK);
+	testModelString("XYZ", 70, 20, COLOR_GREEN, COLOR_BLACK);
+	drawStringAtPosition("ABCDE", 67, 20, COLOR_GREEN, COLOR_BLACK);
+	testModelString("ABCDE", 67, 20, COLOR_GREEN, COLOR_BLACK);
+	// Blanks over a blank screen aren't changes at all
+	drawStringAtPosition("    ", 0, 30, COLOR_LIGHTGREY, COLOR_BLACK);
+	testModelString("    ", 0, 30, COLOR_LIGHTGREY, COLOR_BLACK);
+
+	testSpansMatch("overlapping: spans aren't what was drawn");
+	if (textDirtyStart[3] != 10 || textDirtyEnd[3] != 41 || textDirtyStart[20] != 67 || textDirtyEnd[20] != 73)
+	{
+		testFail("overlapping: spans didn't take in every draw on the row");
+	}
+	if (textDirtyStart[30] != TEXT_ROW_CLEAN)
+	{
+		testFail("overlapping: unchanged row got marked");
+	}
+
+	flushTextScreen(testScreen);
+	// Inside a span the screen has the back buffer, outside it nothing was written at all
+	for (i = 0; i < TEST_CELLS; i++)
+	{
+		x = (uint8_t)(i % 80);
+		if (testStart[i / 80] != TEXT_ROW_CLEAN && x >= testStart[i / 80] && x < testEnd[i / 80])
+		{
+			if (testScreen[i] != textBackBuffer[i] || testScreen[i] != testModel[i])
+			{
+				testFail("overlapping: a dirty cell didn't get copied");
+				return;
+			}
+		}
+		else if (testScreen[i] != TEST_UNTOUCHED)
+		{
+			printf("      cell %u,%u\n", x, i / 80);
+			testFail("overlapping: a cell outside the spans got copied");
+			return;
+		}
+	}
+	if (textCellsFlushed != (41 - 10) + (73 - 67))
+	{
+		testFail("overlapping: flushed cell count doesn't match the spans");
+	}
+}
+
+void testSpansReset(void)
+{
+	uint16_t i;
+	uint8_t row;
+
+	testReset();
+	drawStringAtPosition("SPAN", 5, 0, COLOR_WHITE, COLOR_BLACK);
+	drawStringAtPosition("SPAN", 75, 49, COLOR_WHITE, COLOR_BLACK);
+	flushTextScreen(testScreen);
+	for (row = 0; row < TEXT_MAX_ROWS; row++)
+	{
+		if (textDirtyStart[row] != TEXT_ROW_CLEAN || textDirtyEnd[row] != 0)
+		{
+			testFail("spans reset: a row was still dirty after the flush");
+			break;
+		}
+	}
+
+	// Nothing changed since, so the next flush doesn't touch the screen at all
+	for (i = 0; i < TEST_CELLS; i++)
+	{
+		testScreen[i] = TEST_UNTOUCHED;
+	}
+	textCellsFlushed = 0;
+	flushTextScreen(testScreen);
+	for (i = 0; i < TEST_CELLS; i++)
+	{
+		if (testScreen[i] != TEST_UNTOUCHED)
+		{
+			testFail("spans reset: second flush copied something");
+			break;
+		}
+	}
+	if (textCellsFlushed != 0)
+	{
+		testFail("spans reset: second flush counted cells");
+	}
+
+	// A new, narrower draw on the same row only copies itself, not the old span too
+	drawCharacterAtPosition('X', 7, 0, COLOR_WHITE, COLOR_BLACK);
+	if (textDirtyStart[0] != 7 || textDirtyEnd[0] != 8)
+	{
+		testFail("spans reset: new span grew out of the old one");
+	}
+	flushTextScreen(testScreen);
+	if (textCellsFlushed != 1 || testScreen[cellCoordinate(7, 0)] != testCell('X', COLOR_WHITE, COLOR_BLACK) || testScreen[cellCoordinate(5, 0)] != TEST_UNTOUCHED)
+	{
+		testFail("spans reset: new span copied more than the one cell");
+	}
+}
+
+void testFullRedraw(void)
+{
+	uint16_t cells[80];
+	char text[81];
+	uint32_t expectedFlushed;
+	uint32_t frame;
+	uint16_t i;
+	uint8_t draws;
+	uint8_t row;
+	uint8_t x;
+	uint8_t y;
+	uint8_t length;
+	uint8_t foreground;
+
+	testReset();
+	// The BIOS left the real screen blank, and the back buffer starts out matching it
+	for (i = 0; i < TEST_CELLS; i++)
+	{
+		testScreen[i] = TEXT_BLANK_CELL;
+	}
+	testRandomState = 1;
+	for (frame = 0; frame < TEST_FRAMES; frame++)
+	{
+		// A few draws per frame, short and long, often landing on top of each other.  Few characters and colors, so
+		// plenty of them redraw what's already there.
+		draws = (uint8_t)(1 + testRandom(12));
+		while (draws > 0)
+		{
+			y = (uint8_t)testRandom(TEXT_MAX_ROWS);
+			x = (uint8_t)testRandom(80);
+			length = (uint8_t)(1 + testRandom((uint16_t)(80 - x)));
+			if (length > 20 && testRandom(4) != 0)
+			{
+				length = 20;
+			}
+			foreground = (uint8_t)testRandom(3);
+			switch (testRandom(3))
+			{
+				case 0:
+					for (i = 0; i < length; i++)
+					{
+						text[i] = (char)('A' + testRandom(3));
+					}
+					text[length] = '\0';
+					drawStringAtPosition(text, x, y, foreground, COLOR_BLACK);
+					testModelString(text, x, y, foreground, COLOR_BLACK);
+					break;
+				case 1:
+					for (i = 0; i < length; i++)
+					{
+						cells[i] = testCell((char)('A' + testRandom(3)), foreground, COLOR_BLACK);
+					}
+					drawCellsAtPosition(cells, length, x, y);
+					testModelCells(cells, length, x, y);
+					break;
+				default:
+					text[0] = (char)('A' + testRandom(3));
+					text[1] = '\0';
+					drawCharacterAtPosition(text[0], x, y, foreground, COLOR_BLACK);
+					testModelString(text, x, y, foreground, COLOR_BLACK);
+					break;
+			}
+			draws--;
+		}
+
+		testSpansMatch("full redraw: spans aren't what was drawn");
+		expectedFlushed = textCellsFlushed;
+		for (row = 0; row < TEXT_MAX_ROWS; row++)
+		{
+			if (testStart[row] != TEXT_ROW_CLEAN)
+			{
+				expectedFlushed += testEnd[row] - testStart[row];
+			}
+			testStart[row] = TEXT_ROW_CLEAN;
+			testEnd[row] = 0;
+		}
+		flushTextScreen(testScreen);
+		if (textCellsFlushed != expectedFlushed)
+		{
+			testFail("full redraw: flush copied more or less than the spans");
+		}
+
+		// The screen only ever got the spans, but it has to look like it got the whole back buffer every time
+		if (memcmp(testScreen, textBackBuffer, sizeof(testScreen)) != 0 || memcmp(testScreen, testModel, sizeof(testScreen)) != 0)
+		{
+			printf("      frame %lu\n", (unsigned long)frame);
+			testFail("full redraw: screen doesn't match the back buffer");
+			return;
+		}
+	}
+}
+
+int main(void)
+{
+	testOverlapping();
+	testSpansReset();
+	testFullRedraw();
+
+	if (testFailures > 0)
+	{
+		printf("TTEXT: %u failures\n", testFailures);
+		return 1;
+	}
+	printf("TTEXT: OK\n");
+	return 0;
+}
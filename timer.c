@@ -18,6 +18,7 @@
 #include <conio.h>
 #include <dos.h>
 
+#include "fifo.h"
 #include "timer.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -27,6 +28,7 @@
 void interrupt (*biosISR8)(void);
 volatile uint32_t tickCounter = 0;
 volatile uint32_t screenCounter = 0;
+volatile uint8_t timerPaused = FALSE;
 uint16_t biosCounter = 0;
 uint32_t fastTickRate;
 const uint16_t playbackFrequency = 44100;
@@ -71,11 +73,34 @@ void resetTimer(void)
 	_dos_setvect(8, biosISR8);
 }
 
+void setTimerDivider(uint8_t divider)
+{
+	// The interrupt uses both of these, so don't let it fire while they are half-updated
+	_disable();
+	playbackFrequencyDivider = divider;
+	fastTickRate = 1193182 / (playbackFrequency/playbackFrequencyDivider);
+	// Same PIT setup as initTimer, just with the new rate
+	outp(0x43, 0x36);
+	outp(0x40, fastTickRate & 0xFF); // Low byte
+	outp(0x40, fastTickRate >> 8); // High byte
+	_enable();
+}
+
 void interrupt timerHandler(void)
 {
 	// Increment the counter cause the interrupt has happened
-	tickCounter=tickCounter+playbackFrequencyDivider;
+	// While paused the song's clock stands still, but the screen keeps going
+	if (timerPaused == FALSE)
+	{
+		tickCounter=tickCounter+playbackFrequencyDivider;
+	}
 	screenCounter=screenCounter+playbackFrequencyDivider;
+
+	// In ISR write mode, the OPL writes that are due are sent from right here instead of waiting on the main loop
+	if (eventQueueActive && timerPaused == FALSE)
+	{
+		drainEventQueue();
+	}
 	
 	// Since we have changed the timer rate, we have to determine when to call the BIOS ISR8 at its old rate.  This avoids the clock getting messed up.  While it may appear that biosCounter will only be less than fastTickRate one time, it will actually overflow back to 0 over time, making this a constant cycle.
 	biosCounter += fastTickRate;
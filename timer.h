@@ -27,6 +27,7 @@
 
 void initTimer(uint16_t frequency);	// Reprogram the PIT to run at our desired playback rate and insert our interrupt service routine 8 handler.
 void resetTimer (void);				// Restore PIT to its original rate and remove our interrupt service routine 8 handler.
+void setTimerDivider(uint8_t divider);	// Change the playback frequency divider while the timer is already running
 void interrupt timerHandler(void);	// Handler executes every PIT frequency cycle (ISR8)
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,6 +37,7 @@ void interrupt timerHandler(void);	// Handler executes every PIT frequency cycle
 extern void interrupt (*biosISR8)(void);	// Pointer to the BIOS interrupt service routine 8
 extern volatile uint32_t tickCounter;		// Counts the number of timer ticks elapsed
 extern volatile uint32_t screenCounter;		// Tracks 70hz screen refresh
+extern volatile uint8_t timerPaused;		// Set while playback is paused - tickCounter stops counting
 extern uint16_t biosCounter;				// Used to determine when to run the original BIOS ISR8
 extern uint32_t fastTickRate;				// Divider to apply to the 8253 PIT
 extern const uint16_t playbackFrequency;	// Playback frequency (VGM files are set to 44100 Hz)
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TRACE.C - Record every OPL write to a file, and play it back again
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <conio.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "decode.h"
+#include "opl.h"
+#include "settings.h"
+#include "timer.h"
+#include "trace.h"
+#include "txtmode.h"
+#include "ui.h"
+#include "vgm.h"
+#include "vgmslap.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t traceRecording = FALSE;
+FILE *traceFilePointer = NULL;
+uint8_t traceSource = TRACE_SOURCE_PLAYER;
+uint32_t traceWrites = 0;
+uint8_t traceLastSource = 0xFF;		// Source of the last record written - 0xFF so the first record always says
+uint32_t traceLastSample = 0;		// Timestamp of the last record written
+uint32_t traceSongStart = 0;		// Timestamp the current song's sample 0 falls on
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void traceOpen(char* traceFileName)
+{
+	uint8_t header[TRACE_HEADER_SIZE];
+
+	errno = 0;
+	traceFilePointer = fopen(traceFileName, "wb");
+	if (traceFilePointer == NULL)
+	{
+		killProgram(ERROR_TRACE_OUTPUT_FAILED);
+	}
+	// The chip isn't known until detection is done (and detection gets recorded too), so that gets filled in at the end
+	memset(header, 0, sizeof(header));
+	memcpy(header, "VGMTRACE", 8);
+	header[8] = TRACE_VERSION;
+	fwrite(header, 1, sizeof(header), traceFilePointer);
+	traceLastSource = 0xFF;
+	traceLastSample = 0;
+	traceSongStart = 0;
+	traceWrites = 0;
+	traceRecording = TRUE;
+}
+
+void traceToggle(void)
+{
+	// The timer interrupt can't be trusted to write to a file, so there's no recording in ISR write mode
+	if (settings.isrWrite == 1)
+	{
+		return;
+	}
+	if (traceFilePointer == NULL)
+	{
+		traceOpen(settings.tracePath);
+		return;
+	}
+	traceRecording = !traceRecording;
+	if (traceRecording == FALSE)
+	{
+		fflush(traceFilePointer);
+	}
+}
+
+void traceNewSong(void)
+{
+	// Each song's samples start from zero, so pick up the new one where the last one left off
+	traceSongStart = traceLastSample;
+}
+
+void traceRecord(uint16_t reg, uint8_t data)
+{
+	uint8_t record[8];
+	uint8_t length = 1;
+	uint32_t delta = 0;
+
+	// Writes go in the order they happen.  A write timestamped earlier than the last one (like a key press landing
+	// on a sample that's already been passed) just gets the same time as the one before it.
+	if (traceSongStart + dataCurrentSample > traceLastSample)
+	{
+		delta = traceSongStart + dataCurrentSample - traceLastSample;
+		traceLastSample += delta;
+	}
+	record[0] = 0;
+	while (delta > 0)
+	{
+		record[length++] = (uint8_t)(delta & 0xFF);
+		delta >>= 8;
+		record[0]++;
+	}
+	if (traceSource != traceLastSource)
+	{
+		record[0] |= TRACE_FLAG_SOURCE;
+		record[length++] = traceSource;
+		traceLastSource = traceSource;
+	}
+	if (reg & 0x100)
+	{
+		record[0] |= TRACE_FLAG_BANK;
+	}
+	// Second OPL3, when the emulator is running two
+	if (reg & 0x200)
+	{
+		record[0] |= TRACE_FLAG_CHIP;
+	}
+	record[length++] = (uint8_t)(reg & 0xFF);
+	record[length++] = data;
+	fwrite(record, 1, length, traceFilePointer);
+	traceWrites++;
+}
+
+void traceClose(void)
+{
+	uint8_t chip = (uint8_t)detectedChip;
+
+	if (traceFilePointer == NULL)
+	{
+		return;
+	}
+	traceRecording = FALSE;
+	fseek(traceFilePointer, 9, SEEK_SET);
+	fwrite(&chip, 1, 1, traceFilePointer);
+	fclose(traceFilePointer);
+	traceFilePointer = NULL;
+}
+
+uint8_t traceReadRecord(FILE *traceFile, uint32_t *sample, uint8_t *source, uint16_t *reg, uint8_t *data)
+{
+	int flags;
+	uint8_t timeBytes;
+	uint8_t i;
+	uint32_t delta = 0;
+
+	flags = fgetc(traceFile);
+	if (flags == EOF)
+	{
+		return 1;
+	}
+	timeBytes = (uint8_t)flags & TRACE_FLAG_TIME_BYTES;
+	for (i = 0; i < timeBytes; i++)
+	{
+		delta |= (uint32_t)(uint8_t)fgetc(traceFile) << (i * 8);
+	}
+	*sample += delta;
+	if (flags & TRACE_FLAG_SOURCE)
+	{
+		*source = (uint8_t)fgetc(traceFile);
+	}
+	*reg = (uint8_t)fgetc(traceFile);
+	if (flags & TRACE_FLAG_BANK)
+	{
+		*reg += 0x100;
+	}
+	if (flags & TRACE_FLAG_CHIP)
+	{
+		*reg += 0x200;
+	}
+	*data = (uint8_t)fgetc(traceFile);
+	// A record cut off partway means the file was too
+	if (feof(traceFile))
+	{
+		return 1;
+	}
+	return 0;
+}
+
+void traceReplay(char* traceFileName, uint8_t mode)
+{
+	FILE *replayFile;
+	uint8_t header[TRACE_HEADER_SIZE];
+	uint32_t sample = 0;
+	uint8_t source = TRACE_SOURCE_PLAYER;
+	uint16_t reg;
+	uint8_t data;
+	uint32_t writes = 0;
+	uint32_t lateWrites = 0;
+	uint8_t stop = FALSE;
+	uint32_t musicTenths;
+	clock_t startTime;
+	uint32_t elapsedTenths;
+	uint32_t lastSample = 0;
+
+	errno = 0;
+	replayFile = fopen(traceFileName, "rb");
+	if (replayFile == NULL)
+	{
+		killProgram(ERROR_FILE_MISSING);
+	}
+	if (fread(header, 1, sizeof(header), replayFile) != sizeof(header) || memcmp(header, "VGMTRACE", 8) != 0 || header[8] != TRACE_VERSION)
+	{
+		fclose(replayFile);
+		killProgram(ERROR_TRACE_BAD_FILE);
+	}
+
+	// Listing doesn't need a chip at all - the same text can be made from any other player's register log to compare
+	if (mode == TRACE_REPLAY_LIST)
+	{
+		printf("; Trace recorded on chip type %u\n", header[9]);
+		printf(";   Sample  Source  Reg  Data\n");
+		while (traceReadRecord(replayFile, &sample, &source, &reg, &data) == 0)
+		{
+			printf("%10lu  ", sample);
+			tracePrintSource(source);
+			printf("  %03X  %02X\n", reg, data);
+		}
+		fclose(replayFile);
+		return;
+	}
+
+	// Whatever the config says: a real card, or the emulator (which just keeps the register map up to date when there's nothing listening)
+	detectOPL();
+	if (header[9] != (uint8_t)DETECTED_NONE && header[9] != (uint8_t)detectedChip)
+	{
+		printf("Note: this trace was recorded on a different chip type (%u)\n", header[9]);
+	}
+	printf("Replaying %s%s...\n", traceFileName, mode == TRACE_REPLAY_MAX ? " at full speed" : (mode == TRACE_REPLAY_DRAW ? " and drawing the channel table" : ""));
+	// Everything draws into the back buffer, and nothing ever flushes it, so this works without touching the screen
+	if (mode == TRACE_REPLAY_DRAW)
+	{
+		textRows = 50;
+		resetTextBuffer();
+		maxChannels = (detectedChip == DETECTED_OPL2) ? 9 : 18;
+		displayRegisterMax = (maxChannels > 9) ? 0x1FF : 0xFF;
+		clearInterface();
+		drawTextUI();
+		drawPasses = 0;
+		drawChannelUpdates = 0;
+		decodeRegisterCount = 0;
+	}
+	if (mode == TRACE_REPLAY_REALTIME)
+	{
+		initTimer(playbackFrequency);
+		tickCounter = 0;
+	}
+	startTime = clock();
+	while (traceReadRecord(replayFile, &sample, &source, &reg, &data) == 0)
+	{
+		if (mode == TRACE_REPLAY_REALTIME)
+		{
+			// Already more than a tick past due?  Then we're not keeping up.
+			if (tickCounter > sample + playbackFrequencyDivider)
+			{
+				lateWrites++;
+			}
+			// Same rule as processCommands() - a write goes once the timer has passed its sample
+			while (sample >= tickCounter && stop == FALSE)
+			{
+				// Esc to stop
+				if (kbhit() && getch() == 0x1B)
+				{
+					stop = TRUE;
+				}
+			}
+			if (stop == TRUE)
+			{
+				break;
+			}
+		}
+		// Draw whenever the music moves on to a new sample, which is as often as the player ever could
+		if (mode == TRACE_REPLAY_DRAW && sample != lastSample && requestScreenDraw > 0)
+		{
+			drawChannelTable(0);
+		}
+		lastSample = sample;
+		writeOPL(reg, data);
+		writes++;
+	}
+	elapsedTenths = ((uint32_t)(clock() - startTime) * 10) / CLOCKS_PER_SEC;
+	if (mode == TRACE_REPLAY_REALTIME)
+	{
+		resetTimer();
+	}
+	resetOPL();
+	fclose(replayFile);
+
+	musicTenths = sample / 4410;
+	printf("%lu writes over %lu.%lus of music in %lu.%lus", writes, musicTenths / 10, musicTenths % 10, elapsedTenths / 10, elapsedTenths % 10);
+	if ((mode == TRACE_REPLAY_MAX || mode == TRACE_REPLAY_DRAW) && elapsedTenths > 0)
+	{
+		printf(" (%lu writes/sec)", (writes * 10) / elapsedTenths);
+	}
+	printf("\n");
+	if (mode == TRACE_REPLAY_REALTIME)
+	{
+		printf("%lu writes went out late\n", lateWrites);
+	}
+	if (mode == TRACE_REPLAY_DRAW && drawPasses > 0)
+	{
+		// Before the queue, every draw looked at every register from 0x20 up
+		printf("%lu draws, %lu changed registers decoded (%lu per draw, out of %u), %lu channels redrawn (%lu per draw)", drawPasses, decodeRegisterCount, decodeRegisterCount / drawPasses, displayRegisterMax - 0x1F, drawChannelUpdates, drawChannelUpdates / drawPasses);
+		if (elapsedTenths > 0)
+		{
+			printf(", %lu draws/sec, %lu changed registers drawn/sec", (drawPasses * 10) / elapsedTenths, (decodeRegisterCount * 10) / elapsedTenths);
+		}
+		printf("\n");
+	}
+}
+
+void tracePrintSource(uint8_t source)
+{
+	switch (source)
+	{
+		case TRACE_SOURCE_PLAYER:
+			printf("player");
+			break;
+		case TRACE_SOURCE_RESET:
+			printf("reset ");
+			break;
+		case TRACE_SOURCE_DETECT:
+			printf("detect");
+			break;
+		default:
+			printf("vgm %02X", source);
+			break;
+	}
+}
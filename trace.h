@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TRACE.H - Record every OPL write to a file, and play it back again
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_TRACE_H
+#define VGMSLAP_TRACE_H
+
+#include <stdio.h>
+
+#include "types.h"
+
+// Trace file layout:
+//   Header - "VGMTRACE", format version, chip it was recorded on (OplDetectedType), 6 bytes spare
+//   Then one record per write:
+//     Flags byte - bits 0-2: how many bytes of timestamp follow (0-4)
+//                  bit 3: a source byte follows
+//                  bit 4: the register is in the second bank (0x100 and up)
+//                  bit 5: the register is on the second chip (0x200 and up, dual OPL3 in the emulator)
+//     Timestamp  - VGM samples (44100hz) since the last record, little-endian, leading zeroes left off
+//     Source     - only when it's different from the last record
+//     Register   - low 8 bits
+//     Data
+//   Most writes land on the same sample as the one before and come from the same place, so they take 3 bytes.
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 16
+#define TRACE_FLAG_TIME_BYTES 0x07
+#define TRACE_FLAG_SOURCE 0x08
+#define TRACE_FLAG_BANK 0x10
+#define TRACE_FLAG_CHIP 0x20
+
+// Where a write came from.  Anything not listed is a VGM write, and the source is the command it came from (0x5A, 0x5E, etc).
+#define TRACE_SOURCE_PLAYER 0x00	// The player itself (OPL3 mode for dual OPL2 songs and so on)
+#define TRACE_SOURCE_RESET 0x01		// resetOPL()
+#define TRACE_SOURCE_DETECT 0x02	// detectOPL()
+
+// Ways to play a trace back
+#define TRACE_REPLAY_REALTIME 0		// On the timer, same speed it was recorded at
+#define TRACE_REPLAY_MAX 1			// As fast as the chip (or emulator) will take it
+#define TRACE_REPLAY_LIST 2			// Don't play it, just print it out as text
+#define TRACE_REPLAY_DRAW 3			// Full speed, with the channel table drawn (off screen) as it goes, to time the drawing
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void traceOpen(char* traceFileName);	// Start a new trace file
+void traceToggle(void);					// Start or stop recording (the T key)
+void traceNewSong(void);				// Keep the timestamps going up when the next song starts from zero
+void traceRecord(uint16_t reg, uint8_t data);	// Called by writeOPL() while recording
+void traceClose(void);					// Fill in the chip type and close the file
+uint8_t traceReadRecord(FILE *traceFile, uint32_t *sample, uint8_t *source, uint16_t *reg, uint8_t *data);	// Read the next write from a trace (returns 1 at the end)
+void traceReplay(char* traceFileName, uint8_t mode);	// Send a trace to whatever OPL backend is set up (TRACE_REPLAY_*)
+void tracePrintSource(uint8_t source);	// Print a short name for where a write came from
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern uint8_t traceRecording;		// Set while writes are being recorded
+extern FILE *traceFilePointer;		// Trace being recorded
+extern uint8_t traceSource;			// Where the writes being made right now are coming from (TRACE_SOURCE_* or a VGM command)
+extern uint32_t traceWrites;		// How many writes have been recorded
+
+#endif
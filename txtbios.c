@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// TXTBIOS.C - Video mode changes and the text screen itself, for TXTMODE.C
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <conio.h>
+#include <dos.h>
+
+#include "txtmode.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+char far *textScreen = (char far *)0xB8000000;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void setVideoMode(ScreenMode mode)
+{
+	// Using the following numbers to represent what mode to switch to:
+	// 25 = 80x25 text mode
+	// 50 = 80x50 text mode
+	union REGS registers;
+	if (mode == TEXT_80X25)
+	{
+		// Function 00h - Set video mode
+		registers.h.ah = 0x00;
+		// Mode 03h - Text mode
+		registers.h.al = 0x03;
+		// Need to zero these out to reset things
+		registers.w.bx = 0x0000;
+		// Send the parameters to Int 10h
+		int86(0x10, &registers, &registers);
+		textRows = 25;
+	}
+	if (mode == TEXT_80X50)
+	{
+		// Function 00h - Set video mode
+		registers.h.ah = 0x00;
+		// Mode 03h - Text mode
+		registers.h.al = 0x03;
+		// Send the parameters to Int 10h
+		int86(0x10, &registers, &registers);
+		// Function 11h - Change text mode character set
+		registers.h.ah = 0x11;
+		// Load 8x8 font
+		registers.h.al = 0x12;
+		// Need to zero these out to reset things
+		registers.w.bx = 0x0000;
+		// Call Int 10h again
+		int86(0x10, &registers, &registers);
+		// We don't want the blinking cursor to display in 50-column mode
+		outp(0x3D4, 0x0A);
+		outp(0x3D5, 0x20);
+		textRows = 50;
+	}
+	// The BIOS just blanked the screen, so whatever the back buffer had is gone too
+	resetTextBuffer();
+}
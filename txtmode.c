@@ -14,9 +14,6 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-#include <conio.h>
-#include <dos.h>
-
 #include "txtgfx.h"
 #include "txtmode.h"
 #include "vgmslap.h"
@@ -26,7 +23,12 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 char txtDrawBuffer[80];
-char far *textScreen = (char far *)0xB8000000;
+uint16_t far textBackBuffer[80*TEXT_MAX_ROWS];
+uint8_t textDirtyStart[TEXT_MAX_ROWS];
+uint8_t textDirtyEnd[TEXT_MAX_ROWS];
+uint32_t textCellsDrawn = 0;
+uint32_t textCellsChanged = 0;
+uint32_t textCellsFlushed = 0;
 char numToHex[] = "0123456789ABCDEF";
 char textRows = 25;
 uint16_t displayRegisterMax = 0xFF;
@@ -49,71 +51,143 @@ void clearTextScreen(void)
 	}
 }
 
-void setVideoMode(ScreenMode mode)
+void resetTextBuffer(void)
 {
-	// Using the following numbers to represent what mode to switch to:
-	// 25 = 80x25 text mode
-	// 50 = 80x50 text mode
-	union REGS registers;
-	if (mode == TEXT_80X25)
+	uint16_t i;
+	uint8_t row;
+
+	for (i = 0; i < 80*TEXT_MAX_ROWS; i++)
 	{
-		// Function 00h - Set video mode
-		registers.h.ah = 0x00;
-		// Mode 03h - Text mode
-		registers.h.al = 0x03;
-		// Need to zero these out to reset things
-		registers.w.bx = 0x0000;
-		// Send the parameters to Int 10h
-		int86(0x10, &registers, &registers);
-		textRows = 25;
+		textBackBuffer[i] = TEXT_BLANK_CELL;
 	}
-	if (mode == TEXT_80X50)
+	for (row = 0; row < TEXT_MAX_ROWS; row++)
 	{
-		// Function 00h - Set video mode
-		registers.h.ah = 0x00;
-		// Mode 03h - Text mode
-		registers.h.al = 0x03;
-		// Send the parameters to Int 10h
-		int86(0x10, &registers, &registers);
-		// Function 11h - Change text mode character set
-		registers.h.ah = 0x11;
-		// Load 8x8 font
-		registers.h.al = 0x12;
-		// Need to zero these out to reset things
-		registers.w.bx = 0x0000;
-		// Call Int 10h again
-		int86(0x10, &registers, &registers);
-		// We don't want the blinking cursor to display in 50-column mode
-		outp(0x3D4, 0x0A);
-		outp(0x3D5, 0x20);
-		textRows = 50;
+		textDirtyStart[row] = TEXT_ROW_CLEAN;
+		textDirtyEnd[row] = 0;
 	}
+}
 
+void flushTextScreen(uint16_t far *screen)
+{
+	uint8_t row;
+	uint16_t cell;
+	uint16_t lastCell;
+
+	// Only the changed part of each row goes out, a whole cell (character and attribute) per write.
+	// On a slow ISA card this is where the time goes, so everything else happens in regular memory first.
+	for (row = 0; row < textRows; row++)
+	{
+		if (textDirtyStart[row] == TEXT_ROW_CLEAN)
+		{
+			continue;
+		}
+		cell = cellCoordinate(textDirtyStart[row], row);
+		lastCell = cellCoordinate(textDirtyEnd[row], row);
+		textCellsFlushed += lastCell - cell;
+		while (cell < lastCell)
+		{
+			screen[cell] = textBackBuffer[cell];
+			cell++;
+		}
+		textDirtyStart[row] = TEXT_ROW_CLEAN;
+		textDirtyEnd[row] = 0;
+	}
+}
+
+void markTextDirty(uint8_t yPos, uint8_t xStart, uint8_t xEnd)
+{
+	if (xStart < textDirtyStart[yPos] || textDirtyStart[yPos] == TEXT_ROW_CLEAN)
+	{
+		textDirtyStart[yPos] = xStart;
+	}
+	if (xEnd > textDirtyEnd[yPos])
+	{
+		textDirtyEnd[yPos] = xEnd;
+	}
 }
 
 void drawCharacterAtPosition(char text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor)
 {
-	// Combine foreground and background attribute
-	uint8_t attribute = foregroundColor | (backgroundColor << 4);
-	// Generate the correct memory location to put the text using our predefined coordinate function
-	uint16_t screenAddress = characterCoordinate(xPos, yPos);
-	textScreen[screenAddress++] = text;
-	textScreen[screenAddress++] = attribute;
+	// Combine character, foreground and background attribute into one cell
+	uint16_t cellValue = (uint8_t)text | ((uint16_t)(foregroundColor | (backgroundColor << 4)) << 8);
+	// Generate the correct back buffer location using our predefined coordinate function
+	uint16_t cell = cellCoordinate(xPos, yPos);
+
+	textCellsDrawn++;
+	// Same as what's already there?  Then the screen doesn't need to hear about it.
+	if (textBackBuffer[cell] != cellValue)
+	{
+		textBackBuffer[cell] = cellValue;
+		textCellsChanged++;
+		markTextDirty(yPos, xPos, xPos + 1);
+	}
 }
 
 void drawStringAtPosition(char* text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor)
 {
+	// Combine foreground and background attribute, already shifted up to where it sits in the cell
+	uint16_t attribute = (uint16_t)(foregroundColor | (backgroundColor << 4)) << 8;
+	uint16_t cellValue;
+	// Generate the correct back buffer location using our predefined coordinate function
+	uint16_t cell = cellCoordinate(xPos, yPos);
+	uint8_t firstChanged = TEXT_ROW_CLEAN;
+	uint8_t lastChanged = 0;
 
-	// Combine foreground and background attribute
-	uint8_t attribute = foregroundColor | (backgroundColor << 4);
-	// Generate the correct memory location to put the text using our predefined coordinate function
-	uint16_t screenAddress = characterCoordinate(xPos, yPos);
+	// Keep track of the changed part of the string, so the row only gets marked once
 	while (*text)
 	{
-		textScreen[screenAddress++] = *text;
-		textScreen[screenAddress++] = attribute;
+		cellValue = (uint8_t)*text | attribute;
+		textCellsDrawn++;
+		if (textBackBuffer[cell] != cellValue)
+		{
+			textBackBuffer[cell] = cellValue;
+			textCellsChanged++;
+			if (firstChanged == TEXT_ROW_CLEAN)
+			{
+				firstChanged = xPos;
+			}
+			lastChanged = xPos;
+		}
+		cell++;
+		xPos++;
 		text++;
 	}
+	if (firstChanged != TEXT_ROW_CLEAN)
+	{
+		markTextDirty(yPos, firstChanged, lastChanged + 1);
+	}
+}
+
+void drawCellsAtPosition(const uint16_t far *cells, uint8_t count, uint8_t xPos, uint8_t yPos)
+{
+	// Generate the correct back buffer location using our predefined coordinate function
+	uint16_t cell = cellCoordinate(xPos, yPos);
+	uint8_t firstChanged = TEXT_ROW_CLEAN;
+	uint8_t lastChanged = 0;
+
+	// Like drawStringAtPosition, but the cells already have their colors, so there's nothing to put together
+	while (count > 0)
+	{
+		textCellsDrawn++;
+		if (textBackBuffer[cell] != *cells)
+		{
+			textBackBuffer[cell] = *cells;
+			textCellsChanged++;
+			if (firstChanged == TEXT_ROW_CLEAN)
+			{
+				firstChanged = xPos;
+			}
+			lastChanged = xPos;
+		}
+		cell++;
+		cells++;
+		xPos++;
+		count--;
+	}
+	if (firstChanged != TEXT_ROW_CLEAN)
+	{
+		markTextDirty(yPos, firstChanged, lastChanged + 1);
+	}
 }
 
 void drawGraphicAtPosition(const char* graphicArray, uint8_t xSize, uint8_t ySize, uint8_t xOrigin, uint8_t yOrigin)
@@ -121,17 +195,37 @@ void drawGraphicAtPosition(const char* graphicArray, uint8_t xSize, uint8_t ySiz
 	uint8_t xCount;
 	uint8_t yCount;
 	uint16_t maxChars = xSize*ySize;
-	uint16_t screenAddress;
+	uint16_t cell;
+	uint16_t cellValue;
+	uint8_t firstChanged;
+	uint8_t lastChanged;
 
 	for (yCount = 0; yCount < ySize; yCount++)
 	{
+		// Generate the correct back buffer location using our predefined coordinate function
+		cell = cellCoordinate(xOrigin, (yOrigin+yCount));
+		firstChanged = TEXT_ROW_CLEAN;
+		lastChanged = 0;
 		for (xCount = 0; xCount < xSize; xCount++)
 		{
-			// Generate the correct memory location to put the text using our predefined coordinate function
-			screenAddress = characterCoordinate((xOrigin+xCount), (yOrigin+yCount));
-			// Throw the data from the graphic array into memory at that location (character then attribute)
-			textScreen[screenAddress++] = graphicArray[(xCount+(yCount*xSize))];
-			textScreen[screenAddress++] = graphicArray[((xCount+(yCount*xSize))+maxChars)];
+			// Character and attribute from the graphic array, put together into one cell
+			cellValue = (uint8_t)graphicArray[(xCount+(yCount*xSize))] | ((uint16_t)(uint8_t)graphicArray[((xCount+(yCount*xSize))+maxChars)] << 8);
+			textCellsDrawn++;
+			if (textBackBuffer[cell] != cellValue)
+			{
+				textBackBuffer[cell] = cellValue;
+				textCellsChanged++;
+				if (firstChanged == TEXT_ROW_CLEAN)
+				{
+					firstChanged = xOrigin + xCount;
+				}
+				lastChanged = xOrigin + xCount;
+			}
+			cell++;
+		}
+		if (firstChanged != TEXT_ROW_CLEAN)
+		{
+			markTextDirty(yOrigin + yCount, firstChanged, lastChanged + 1);
 		}
 	}
 }
@@ -141,17 +235,33 @@ void drawLevelBar(const char* graphicArray, uint8_t value, uint8_t xOrigin, uint
 	uint8_t xCount;
 	uint8_t yCount;
 	uint8_t maxChars = 6;
-	uint16_t screenAddress;
-	
-	for (xCount = 0; xCount < width; xCount++)
+	uint16_t cell;
+	uint16_t cellValue;
+	uint8_t changed;
+
+	// Every column of a bar is the same, so go a row at a time and only work out each row's cell once
+	for (yCount = 0; yCount < maxChars; yCount++)
 	{
-		for (yCount = 0; yCount < maxChars; yCount++)
+		// Character for this level and row, and the attribute for the row.  96 = 6 chars per level * 16 levels to get to attribute data.
+		cellValue = (uint8_t)graphicArray[((value*maxChars)+(yCount))] | ((uint16_t)(uint8_t)graphicArray[(96+yCount)] << 8);
+		// Generate the correct back buffer location using our predefined coordinate function
+		cell = cellCoordinate(xOrigin, (yOrigin+yCount));
+		changed = FALSE;
+		for (xCount = 0; xCount < width; xCount++)
+		{
+			textCellsDrawn++;
+			if (textBackBuffer[cell] != cellValue)
+			{
+				textBackBuffer[cell] = cellValue;
+				textCellsChanged++;
+				changed = TRUE;
+			}
+			cell++;
+		}
+		// Bars are only a few columns wide, so the whole width gets marked if any of it changed
+		if (changed == TRUE)
 		{
-			// Generate the correct memory location to put the text using our predefined coordinate function
-			screenAddress = characterCoordinate((xOrigin+xCount), (yOrigin+yCount));
-			// Throw the data from the graphic array into memory at that location (character then attribute)
-			textScreen[screenAddress++] = graphicArray[((value*maxChars)+(yCount))];
-			textScreen[screenAddress++] = graphicArray[(96+yCount)]; // 96 = 6 chars per level * 16 levels to get to attribute data
+			markTextDirty(yOrigin + yCount, xOrigin, xOrigin + width);
 		}
 	}
 }
@@ -23,23 +23,43 @@
 // Macro definitions
 ///////////////////////////////////////////////////////////////////////////////
 
-#define characterCoordinate(xPos, yPos) 2*((yPos*80)+xPos)
+#define cellCoordinate(xPos, yPos) (((yPos)*80)+(xPos))
+
+// Tallest text mode we use, for sizing the back buffer
+#define TEXT_MAX_ROWS 50
+
+// What the BIOS fills the screen with on a mode change - a light grey space on black
+#define TEXT_BLANK_CELL 0x0720
+
+// Marks a row with nothing waiting to be copied to the screen
+#define TEXT_ROW_CLEAN 0xFF
 
 ///////////////////////////////////////////////////////////////////////////////
 // Function declarations
 ///////////////////////////////////////////////////////////////////////////////
 
+// TXTMODE.C
 void clearTextScreen(void); 		// Blanks out the text screen by writing spaces
+void resetTextBuffer(void);			// Fill the back buffer to match a freshly blanked screen, with nothing waiting
+void flushTextScreen(uint16_t far *screen);	// Copy every changed cell from the back buffer to the screen (or any 80 column buffer), once per frame
+void markTextDirty(uint8_t yPos, uint8_t xStart, uint8_t xEnd);	// Widen a row's span of changed cells to take in xStart up to (not including) xEnd
+
+// TXTBIOS.C
 void setVideoMode(ScreenMode mode);	// Change screen mode and set parameters needed
 
 // Text-drawing functions
 
-// Put a character directly into memory at a given coordinate
+// All of these draw into the back buffer, and only cells that actually changed get marked for flushTextScreen
+
+// Put a character into memory at a given coordinate
 void drawCharacterAtPosition(char text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor);
 
-// Put a full string directly into memory at a given coordinate
+// Put a full string into memory at a given coordinate
 void drawStringAtPosition(char* text, uint8_t xPos, uint8_t yPos, uint8_t foregroundColor, uint8_t backgroundColor);
 
+// Put cells that already have their colors (see cells.h) into memory at a given coordinate
+void drawCellsAtPosition(const uint16_t far *cells, uint8_t count, uint8_t xPos, uint8_t yPos);
+
 // Put an array based "graphic" into memory at a given coordinate
 // Pass the name of the graphic array, dimensions, and then where you want it to start (top left)
 void drawGraphicAtPosition(const char* graphicArray, uint8_t xSize, uint8_t ySize, uint8_t xOrigin, uint8_t yOrigin);
@@ -54,6 +74,12 @@ void drawLevelBar(const char* graphicArray, uint8_t value, uint8_t xOrigin, uint
 
 extern char txtDrawBuffer[80];		// Temporary buffer line for text display
 extern char far *textScreen;		// VGA text screen memory location
+extern uint16_t far textBackBuffer[80*TEXT_MAX_ROWS];	// What the screen should look like, character in the low byte and attribute in the high
+extern uint8_t textDirtyStart[TEXT_MAX_ROWS];	// First changed column on each row, or TEXT_ROW_CLEAN
+extern uint8_t textDirtyEnd[TEXT_MAX_ROWS];		// Column just past the last changed one on each row
+extern uint32_t textCellsDrawn;		// How many cells the drawing functions were asked for
+extern uint32_t textCellsChanged;	// How many of those were actually different from what was there
+extern uint32_t textCellsFlushed;	// How many cells were copied to the screen
 extern char numToHex[];				// For quick num > hex conversion
 extern char textRows;				// Number of rows in text mode
 extern uint16_t displayRegisterMax;	// How many registers to iterate for screen refresh
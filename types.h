@@ -29,9 +29,21 @@
 // Use these where possible to reduce bit/signing confusion
 // Example, recall that "char" is default unsigned, but "int" is default signed
 
+#ifdef __WATCOMC__
 typedef unsigned char uint8_t;
 typedef unsigned short uint16_t;
 typedef unsigned long uint32_t;
+typedef signed char int8_t;
+typedef signed short int16_t;
+typedef signed long int32_t;
+#else
+// Anything else is the host compiler building the tests in TESTS\, where long can be 64 bits, so use the real thing.
+// There's no segmented memory or ISR calling convention there either.
+#include <limits.h>
+#include <stdint.h>
+#define far
+#define interrupt
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////
 // Enum declarations
@@ -57,7 +69,14 @@ typedef enum{
 	ERROR_LOAD_FAILED_PLAYLIST,
 	ERROR_LOAD_FAILED_VGM,
 	ERROR_LOAD_FAILED_ZLIB,
-	ERROR_LOAD_FAILED_TEMPFILE
+	ERROR_LOAD_FAILED_TEMPFILE,
+	ERROR_RENDER_OUTPUT_FAILED,
+	ERROR_RENDER_NO_MEMORY,
+	ERROR_TRACE_OUTPUT_FAILED,
+	ERROR_TRACE_BAD_FILE,
+	ERROR_RENDER_STEMS_UNSUPPORTED,
+	ERROR_GOLDEN_FILE_FAILED,
+	ERROR_GOLDEN_THRESHOLD_FAILED
 } ProgramExitCode;
 
 typedef enum{
@@ -74,16 +93,23 @@ typedef enum{
 	VGM_DUAL_OPL1,   // 2xOPL2 / OPL3
 	VGM_DUAL_OPL2,   // 2xOPL2 / OPL3
 	VGM_OPL1_OPL2,   // 2xOPL2 / OPL3
-	VGM_DUAL_OPL3    // 2xOPL3 (theoretically possible but no way of testing - yet)
+	VGM_DUAL_OPL3    // 2xOPL3 (emulator only)
 } VgmChipType;
 
 typedef enum{
 	DETECTED_NONE,
 	DETECTED_OPL2,
 	DETECTED_DUAL_OPL2,
-	DETECTED_OPL3
+	DETECTED_OPL3,
+	DETECTED_DUAL_OPL3	// Only ever emulated
 } OplDetectedType;
 
+// Where writeOPL() sends its data
+typedef enum{
+	OUTPUT_HARDWARE,	// A real OPL chip on the ISA bus
+	OUTPUT_EMULATOR		// The software OPL in OPLEMU.C
+} OplOutputType;
+
 typedef enum{
 	PHASE_ATTACK,
 	PHASE_DECAY,
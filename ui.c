@@ -18,10 +18,14 @@
 #include <conio.h>
 #include <libgen.h>
 
+#include "cells.h"
+#include "decode.h"
 #include "opl.h"
 #include "playlist.h"
 #include "settings.h"
+#include "timer.h"
 #include "txtgfx.h"
+#include "trace.h"
 #include "txtmode.h"
 #include "ui.h"
 #include "vgm.h"
@@ -35,6 +39,11 @@ uint8_t keyboardCurrent = 0;
 uint8_t keyboardPrevious = 0;
 uint8_t keyboardExtendedFlag = 0;
 uint8_t requestScreenDraw;
+uint32_t drawPasses = 0;
+uint32_t drawChannelUpdates = 0;
+uint32_t drawFramesDrawn = 0;
+uint32_t drawFramesSkipped = 0;
+uint32_t drawBudgetOverruns = 0;
 
 adsrSimulationChannels adsrSim[18];
 
@@ -68,869 +77,615 @@ void clearInterface(void)
 	}
 }
 
-void drawChannelTable(void)
+void drawChannelTable(uint32_t budget)
 {
-	uint16_t i;
-	uint16_t j;
-	uint16_t k;
+	uint8_t i;
+	uint8_t pass;
+	uint8_t remaining;
 	uint8_t targetChannel;
-	uint8_t targetOperator;
-	uint8_t tempAttribute = 0x0;
-	uint8_t tempNoteSymbol;
+	uint16_t fields;
+	uint8_t outOfTime = FALSE;
+	uint32_t drawStart = tickCounter;
+
+	// Catch up on anything written since the main loop last decoded
+	decodeOPLChanges();
 
-	// Start at 0x20 as that is the lowest register we care about
-	for (i = 0x20; i <= displayRegisterMax; i++)
+	// Channels moving around redraws bits of the others, so that goes first, budget or not
+	if (decodeGlobalChanges & DECODE_GLOBAL_4OP)
 	{
-		// Found a changed register
-		if (oplChangeMap[i] == 1)
-		{
-			// What register changed?
+		drawChannelLayout();
+	}
+	decodeGlobalChanges = 0;
 
-			// Tremolo / Vibrato / Sustain / KSR Flags & Multiplier
-			if ((i >= 0x20 && i <= 0x35) || (i >= 0x120 && i <= 0x135))
+	// Two goes over the channels that changed, in the order they changed.
+	// Notes starting and stopping are what you actually watch for, so the first go only does key-ons, and the second does everything else.
+	// If we run out of time partway, whatever's left stays marked in decodeChannelChanges for the next frame.
+	// With no time limit there's nothing to put first, so it's straight to the second go.
+	for (pass = (budget > 0) ? 0 : 1; pass < 2; pass++)
+	{
+		for (i = 0; i < decodeChangedCount; i++)
+		{
+			targetChannel = decodeChangedChannels[i];
+			fields = decodeChannelChanges[targetChannel];
+			if (pass == 0)
 			{
-				if (i >= 0x20 && i <= 0x35)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x20)];
-					targetOperator = oplOffsetToOperator[(i - 0x20)];
-				}
-				else if (i >= 0x120 && i <= 0x135)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x120)] + 9;
-					targetOperator = oplOffsetToOperator[(i - 0x120)];
-				}
-
-				// Multiplier
-				oplStatus.channels[targetChannel].operators[targetOperator].frequencyMultiplierFactor = (oplRegisterMap[i] & 0x0F);
-
-				// Tremolo
-				oplStatus.channels[targetChannel].operators[targetOperator].flagTremolo = ((oplRegisterMap[i] >> 7) & 0x01);
-
-				// Vibrato
-				oplStatus.channels[targetChannel].operators[targetOperator].flagFrequencyVibrato = ((oplRegisterMap[i] >> 6) & 0x01);
-
-				// Sustain
-				oplStatus.channels[targetChannel].operators[targetOperator].flagSoundSustaining = ((oplRegisterMap[i] >> 5) & 0x01);
-
-				// KSR
-				oplStatus.channels[targetChannel].operators[targetOperator].flagKSR = ((oplRegisterMap[i] >> 4) & 0x01);
+				fields &= DECODE_KEY;
+			}
+			if (fields == 0)
+			{
+				continue;
+			}
+			decodeChannelChanges[targetChannel] &= ~fields;
+			if (targetChannel < maxChannels)
+			{
+				drawChannelFields(targetChannel, fields);
+				drawChannelUpdates++;
+			}
+			// Checked after drawing, so every frame gets at least one channel done no matter how slow things are
+			if (budget > 0 && (tickCounter - drawStart) >= budget)
+			{
+				outOfTime = TRUE;
+				pass = 2;
+				break;
+			}
+		}
+	}
 
-				if (targetOperator == 0)
-				{
-					// Multiplier
-					drawStringAtPosition(oplMultiplierNames[oplStatus.channels[targetChannel].operators[targetOperator].frequencyMultiplierFactor], oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+15, oplStatus.channels[targetChannel].displayY+1,COLOR_LIGHTCYAN,COLOR_BLACK);
+	// Squeeze out the channels that are done, keeping the rest in order.  Ones that aren't on screen just get dropped.
+	remaining = 0;
+	for (i = 0; i < decodeChangedCount; i++)
+	{
+		targetChannel = decodeChangedChannels[i];
+		if (targetChannel >= maxChannels)
+		{
+			decodeChannelChanges[targetChannel] = 0;
+		}
+		if (decodeChannelChanges[targetChannel] != 0)
+		{
+			decodeChangedChannels[remaining] = targetChannel;
+			remaining++;
+		}
+	}
+	decodeChangedCount = remaining;
+	if (outOfTime == TRUE && decodeChangedCount > 0)
+	{
+		drawBudgetOverruns++;
+	}
 
-					// Tremolo
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagTremolo == 1)
-					{
-						drawCharacterAtPosition('T', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+10, oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+10, oplStatus.channels[targetChannel].displayY+1, COLOR_DARKGREY, COLOR_BLACK);
-					}
+	// Draw operation is done, unless there's more waiting
+	drawPasses++;
+	// In ISR write mode the timer interrupt can queue a register and set requestScreenDraw right between us looking at the queue and clearing the flag.
+	// Hold the write lock (it'll just wait a tick) so that change can't get lost until the next write comes along.
+	oplWriteLock = 1;
+	requestScreenDraw = (oplChangeHead != oplChangeTail || decodeChangedCount > 0) ? 1 : 0;
+	oplWriteLock = 0;
+}
 
-					// Vibrato
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagFrequencyVibrato == 1)
-					{
-						drawCharacterAtPosition('V', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+11, oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+11, oplStatus.channels[targetChannel].displayY+1, COLOR_DARKGREY, COLOR_BLACK);
-					}
+void drawChannelFields(uint8_t targetChannel, uint16_t fields)
+{
+	uint8_t tempAttribute = 0x0;
+	uint8_t tempNoteSymbol;
 
-					// Sustain
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagSoundSustaining == 1)
-					{
-						drawCharacterAtPosition('S', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+12, oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+12, oplStatus.channels[targetChannel].displayY+1, COLOR_DARKGREY, COLOR_BLACK);
-					}
+	// Operator parameters, each in their own row
+	drawOperatorFields(targetChannel, 0, fields);
+	drawOperatorFields(targetChannel, 1, fields >> DECODE_OP2_SHIFT);
 
-					// KSR
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagKSR == 1)
-					{
-						drawCharacterAtPosition('K', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+13, oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+13, oplStatus.channels[targetChannel].displayY+1, COLOR_DARKGREY, COLOR_BLACK);
-					}
-				}
-				else if (targetOperator == 1)
+	// Frequency (Low)
+	if (fields & DECODE_FREQUENCY)
+	{
+		// Entire frequency must be redrawn because it's split between bytes
+		if (targetChannel <= 5 || (targetChannel >= 9 && targetChannel <= 14))
+		{
+			if (oplStatus.channels[targetChannel].flag4Op == 1)
+			{
+				if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
 				{
-					// Multiplier
-					drawStringAtPosition(oplMultiplierNames[oplStatus.channels[targetChannel].operators[targetOperator].frequencyMultiplierFactor],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+15,oplStatus.channels[targetChannel].displayY+3,COLOR_LIGHTGREEN, COLOR_BLACK);
-
-					// Tremolo
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagTremolo == 1)
-					{
-						drawCharacterAtPosition('T', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+10, oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+10, oplStatus.channels[targetChannel].displayY+3, COLOR_DARKGREY, COLOR_BLACK);
-					}
-
-					// Vibrato
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagFrequencyVibrato == 1)
-					{
-						drawCharacterAtPosition('V', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+11, oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+11, oplStatus.channels[targetChannel].displayY+3, COLOR_DARKGREY, COLOR_BLACK);
-					}
-
-					// Sustain
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagSoundSustaining == 1)
-					{
-						drawCharacterAtPosition('S', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+12, oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+12, oplStatus.channels[targetChannel].displayY+3, COLOR_DARKGREY, COLOR_BLACK);
-					}
-
-					// KSR
-					if (oplStatus.channels[targetChannel].operators[targetOperator].flagKSR == 1)
-					{
-						drawCharacterAtPosition('K', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+13, oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREY, COLOR_BLACK);
-					}
-					else
-					{
-						drawCharacterAtPosition('-', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+13, oplStatus.channels[targetChannel].displayY+3, COLOR_DARKGREY, COLOR_BLACK);
-					}
+					// Frequency number
+					drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+4);
 				}
 			}
-
-			// KSL / Output Level
-			else if ((i >= 0x40 && i <= 0x55) || (i >= 0x140 && i <= 0x155))
+			else
 			{
-				if (i >= 0x40 && i <= 0x55)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x40)];
-					targetOperator = oplOffsetToOperator[(i - 0x40)];
-				}
-				else if (i >= 0x140 && i <= 0x155)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x140)] + 9;
-					targetOperator = oplOffsetToOperator[(i - 0x140)];
-				}
-
-				// Key Scaling Level
-				oplStatus.channels[targetChannel].operators[targetOperator].keyScaleLevel = (oplRegisterMap[i] >> 6);
-
-				// Output level
-				oplStatus.channels[targetChannel].operators[targetOperator].outputLevel = (oplRegisterMap[i] & 0x3F);
-
-				if (targetOperator == 0)
-				{
-					// Output level
-					sprintf(txtDrawBuffer, "%.2X", oplStatus.channels[targetChannel].operators[targetOperator].outputLevel);
-					drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+21,oplStatus.channels[targetChannel].displayY+1,COLOR_LIGHTCYAN, COLOR_BLACK);
+				// Frequency number
+				drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+2);
+			}
+		}
+		// Positioning for 2-op channels
+		else
+		{
+			// Frequency number
+			drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+2);
+		}
+	}
 
-					// Key Scaling Level
-					drawStringAtPosition(oplKSLNames[oplStatus.channels[targetChannel].operators[targetOperator].keyScaleLevel],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+17,oplStatus.channels[targetChannel].displayY+1,COLOR_LIGHTCYAN, COLOR_BLACK);
+	// Key-On, Block, Frequency (High)
+	if (fields & DECODE_KEY)
+	{
+		// Setup data for ADSR simulation (level bars)
 
-				}
-				else if (targetOperator == 1)
-				{
-					// Output level
-					sprintf(txtDrawBuffer, "%.2X", oplStatus.channels[targetChannel].operators[targetOperator].outputLevel);
-					drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+21,oplStatus.channels[targetChannel].displayY+3,COLOR_LIGHTGREEN, COLOR_BLACK);
+		// A new note is being triggered - start attack
+		if (oplStatus.channels[targetChannel].keyOn == TRUE)
+		{
+			adsrSim[targetChannel].phase = PHASE_ATTACK;
+		}
+		// If key is off, then we are in release mode
+		// If sustain bit is off we might already be in this mode, that's okay
+		else
+		{
+			adsrSim[targetChannel].phase = PHASE_RELEASE;
+		}
 
-					// Key Scaling Level
-					drawStringAtPosition(oplKSLNames[oplStatus.channels[targetChannel].operators[targetOperator].keyScaleLevel],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+17,oplStatus.channels[targetChannel].displayY+3,COLOR_LIGHTGREEN, COLOR_BLACK);
-				}
+		// Set symbol to use for note
+		if ((targetChannel >= 6 && targetChannel <=8))
+		{
+			if (oplStatus.flagPercussionMode == TRUE)
+			{
+				tempNoteSymbol = CHAR_EXCLAMATION;
 			}
-
-			// Attack/Decay
-			else if ((i >= 0x60 && i <= 0x75) || (i >= 0x160 && i <= 0x175))
+			else
 			{
-				if (i >= 0x60 && i <= 0x75)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x60)];
-					targetOperator = oplOffsetToOperator[(i - 0x60)];
-				}
-				else if (i >= 0x160 && i <= 0x175)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x160)] + 9;
-					targetOperator = oplOffsetToOperator[(i - 0x160)];
-				}
-
-				oplStatus.channels[targetChannel].operators[targetOperator].attackRate = (oplRegisterMap[i] >> 4);
-				oplStatus.channels[targetChannel].operators[targetOperator].decayRate = (oplRegisterMap[i] & 0x0F);
-
-				if (targetOperator == 0)
-				{
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].attackRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+5,oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTCYAN, COLOR_BLACK);
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].decayRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+6,oplStatus.channels[targetChannel].displayY+1,COLOR_LIGHTCYAN, COLOR_BLACK);
-				}
-				else if (targetOperator == 1)
-				{
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].attackRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+5,oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREEN, COLOR_BLACK);
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].decayRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+6,oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREEN, COLOR_BLACK);
-				}
+				tempNoteSymbol = CHAR_MUSIC_NOTE;
 			}
+		}
+		else
+		{
+			tempNoteSymbol = CHAR_MUSIC_NOTE;
+		}
 
-			// Sustain/Release
-			else if ((i >= 0x80 && i <= 0x95) || (i >= 0x180 && i <= 0x195))
-			{
-				if (i >= 0x80 && i <= 0x95)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x80)];
-					targetOperator = oplOffsetToOperator[(i - 0x80)];
-				}
-				else if (i >= 0x180 && i <= 0x195)
-				{
-					targetChannel = oplOperatorToChannel[(i - 0x180)] + 9;
-					targetOperator = oplOffsetToOperator[(i - 0x180)];
-				}
+		// Set what color to draw the Note icon with based on whether Key-On was set.
+		if (oplStatus.channels[targetChannel].keyOn == TRUE)
+		{
+			tempAttribute = COLOR_LIGHTMAGENTA;
+		}
+		else
+		{
+			tempAttribute = COLOR_DARKGREY;
+		}
 
-				oplStatus.channels[targetChannel].operators[targetOperator].sustainLevel = (oplRegisterMap[i] >> 4);
-				oplStatus.channels[targetChannel].operators[targetOperator].releaseRate = (oplRegisterMap[i] & 0x0F);
+		// Draw
+		// Entire frequency must be redrawn because it's split between bytes
 
-				if (targetOperator == 0)
-				{
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].sustainLevel],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+7,oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTCYAN, COLOR_BLACK);
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].releaseRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+8,oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTCYAN, COLOR_BLACK);
-				}
-				else if (targetOperator == 1)
+		if (targetChannel <= 5 || (targetChannel >= 9 && targetChannel <= 14))
+		{
+			if (oplStatus.channels[targetChannel].flag4Op == 1)
+			{
+				if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
 				{
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].sustainLevel],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+7,oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREEN, COLOR_BLACK);
-					drawCharacterAtPosition(numToHex[oplStatus.channels[targetChannel].operators[targetOperator].releaseRate],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+8,oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREEN, COLOR_BLACK);
+					// Block number
+					drawCellsAtPosition(cellBlock[oplStatus.channels[targetChannel].blockNumber], CELLS_BLOCK, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+3);
+					// Frequency number
+					drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+4);
+					// Key on
+					drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+5, tempAttribute, COLOR_BLACK);
 				}
 			}
-
-			// Frequency (Low)
-
-			else if ((i >= 0xA0 && i <= 0xA8) || (i >= 0x1A0 && i <= 0x1A8))
+			else
 			{
-				if (i >= 0xA0 && i <= 0xA8)
-				{
-					targetChannel = i - 0xA0;
-				}
-				else if (i >= 0x1A0 && i <= 0x1A8)
-				{
-					targetChannel = (i - 0x1A0) + 9;
-				}
+				// Block number
+				drawCellsAtPosition(cellBlock[oplStatus.channels[targetChannel].blockNumber], CELLS_BLOCK, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+1);
+				// Frequency number
+				drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+2);
+				// Key on
+				drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+3, tempAttribute, COLOR_BLACK);
+			}
+		}
+		// Positioning for 2-op channels
+		else
+		{
+			// Block number
+			drawCellsAtPosition(cellBlock[oplStatus.channels[targetChannel].blockNumber], CELLS_BLOCK, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+1);
+			// Frequency number
+			drawCellsAtPosition(cellFrequency[oplStatus.channels[targetChannel].frequencyNumber], CELLS_FREQUENCY, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, oplStatus.channels[targetChannel].displayY+2);
+			// Key on
+			drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+3, tempAttribute, COLOR_BLACK);
+		}
+	}
 
-				oplStatus.channels[targetChannel].frequencyNumber = (oplRegisterMap[i]) + ((oplRegisterMap[i+0x10] & 0x03) << 8);
+	// Panning, Feedback, Algorithm
+	if (fields & DECODE_ALGORITHM)
+	{
+		drawChannelAlgorithm(targetChannel);
+	}
 
-				// Entire frequency must be redrawn because it's split between bytes
-				if (targetChannel <= 5 || (targetChannel >= 9 && targetChannel <= 14))
-				{
-					if (oplStatus.channels[targetChannel].flag4Op == 1)
-					{
-						if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
-						{
-							// Frequency number
-							sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-							drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+4,COLOR_YELLOW,COLOR_BLACK);
-						}
-					}
-					else
-					{
-						// Frequency number
-						sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-						drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2,COLOR_YELLOW,COLOR_BLACK);
-					}
-				}
-				// Positioning for 2-op channels
-				else
-				{
-					// Frequency number
-					sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-					drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2,COLOR_YELLOW,COLOR_BLACK);
-				}
-			}
+	// Waveform Select
+	if (fields & DECODE_OP1_WAVEFORM)
+	{
+		drawCellsAtPosition(cellWaveform[0][oplStatus.channels[targetChannel].operators[0].waveform], CELLS_WAVEFORM, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS, oplStatus.channels[targetChannel].displayY+1);
+	}
+	if (fields & (DECODE_OP1_WAVEFORM << DECODE_OP2_SHIFT))
+	{
+		drawCellsAtPosition(cellWaveform[1][oplStatus.channels[targetChannel].operators[1].waveform], CELLS_WAVEFORM, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS, oplStatus.channels[targetChannel].displayY+3);
+	}
+}
 
-			// Key-On, Block, Frequency (High)
+void drawOperatorFields(uint8_t targetChannel, uint8_t targetOperator, uint16_t fields)
+{
+	oplOperator *op = &oplStatus.channels[targetChannel].operators[targetOperator];
+	uint8_t x = oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS;
+	// First operator goes on the row under the channel header in cyan, second one two rows down in green
+	uint8_t y = oplStatus.channels[targetChannel].displayY+1+(targetOperator*2);
+	uint8_t color = (targetOperator == 0) ? COLOR_LIGHTCYAN : COLOR_LIGHTGREEN;
+
+	// Tremolo / Vibrato / Sustain / KSR Flags & Multiplier
+	if (fields & DECODE_OP1_FLAGS)
+	{
+		// Multiplier
+		drawCellsAtPosition(cellMultiplier[targetOperator][op->frequencyMultiplierFactor], CELLS_MULTIPLIER, x+15, y);
 
-			else if ((i >= 0xB0 && i <= 0xB8) || (i >= 0x1B0 && i <= 0x1B8))
-			{
-				if (i >= 0xB0 && i <= 0xB8)
-				{
-					targetChannel = i - 0xB0;
-				}
-				else if (i >= 0x1B0 && i <= 0x1B8)
-				{
-					targetChannel = (i - 0x1B0) + 9;
-				}
+		// Tremolo
+		if (op->flagTremolo == 1)
+		{
+			drawCharacterAtPosition('T', x+10, y, COLOR_LIGHTGREY, COLOR_BLACK);
+		}
+		else
+		{
+			drawCharacterAtPosition('-', x+10, y, COLOR_DARKGREY, COLOR_BLACK);
+		}
 
-				// Frequency (High)
-				oplStatus.channels[targetChannel].frequencyNumber = (oplRegisterMap[i-0x10]) + ((oplRegisterMap[i] & 0x03) << 8);
+		// Vibrato
+		if (op->flagFrequencyVibrato == 1)
+		{
+			drawCharacterAtPosition('V', x+11, y, COLOR_LIGHTGREY, COLOR_BLACK);
+		}
+		else
+		{
+			drawCharacterAtPosition('-', x+11, y, COLOR_DARKGREY, COLOR_BLACK);
+		}
 
-				// Block number
-				oplStatus.channels[targetChannel].blockNumber = ((oplRegisterMap[i] >> 2) & 0x07);
+		// Sustain
+		if (op->flagSoundSustaining == 1)
+		{
+			drawCharacterAtPosition('S', x+12, y, COLOR_LIGHTGREY, COLOR_BLACK);
+		}
+		else
+		{
+			drawCharacterAtPosition('-', x+12, y, COLOR_DARKGREY, COLOR_BLACK);
+		}
 
-				// Key on
-				// Don't actually use the keyOn value for channels 7-9 if percussion mode is activated
-				if (targetChannel >=6 && targetChannel <= 8)
-				{
-					if (oplStatus.flagPercussionMode == FALSE)
-					{
-						oplStatus.channels[targetChannel].keyOn = ((oplRegisterMap[i] >> 5) & 0x01);
-					}
-				}
-				else
-				{
-					oplStatus.channels[targetChannel].keyOn = ((oplRegisterMap[i] >> 5) & 0x01);
-				}
-				
-				// Setup data for ADSR simulation (level bars)
-				
-				// A new note is being triggered - start attack
-				if (oplStatus.channels[targetChannel].keyOn == TRUE)
-				{
-					adsrSim[targetChannel].phase = PHASE_ATTACK;
-				}
-				// If key is off, then we are in release mode
-				// If sustain bit is off we might already be in this mode, that's okay
-				else
-				{
-					adsrSim[targetChannel].phase = PHASE_RELEASE;
-				}		
+		// KSR
+		if (op->flagKSR == 1)
+		{
+			drawCharacterAtPosition('K', x+13, y, COLOR_LIGHTGREY, COLOR_BLACK);
+		}
+		else
+		{
+			drawCharacterAtPosition('-', x+13, y, COLOR_DARKGREY, COLOR_BLACK);
+		}
+	}
 
-				// Set symbol to use for note
-				if ((targetChannel >= 6 && targetChannel <=8))
-				{
-					if (oplStatus.flagPercussionMode == TRUE)
-					{
-						tempNoteSymbol = CHAR_EXCLAMATION;
-					}
-					else
-					{
-						tempNoteSymbol = CHAR_MUSIC_NOTE;
-					}
-				}
-				else
-				{
-					tempNoteSymbol = CHAR_MUSIC_NOTE;
-				}
+	// KSL / Output Level
+	if (fields & DECODE_OP1_LEVEL)
+	{
+		// Output level
+		drawCellsAtPosition(cellOutputLevel[targetOperator][op->outputLevel], CELLS_OUTPUT_LEVEL, x+21, y);
 
-				// Set what color to draw the Note icon with based on whether Key-On was set.
-				if (oplStatus.channels[targetChannel].keyOn == TRUE)
-				{
-					tempAttribute = COLOR_LIGHTMAGENTA;
-				}
-				else
-				{
-					tempAttribute = COLOR_DARKGREY;
-				}
+		// Key Scaling Level
+		drawCellsAtPosition(cellKSL[targetOperator][op->keyScaleLevel], CELLS_KSL, x+17, y);
+	}
 
-				// Draw
-				// Entire frequency must be redrawn because it's split between bytes
+	// Attack/Decay
+	if (fields & DECODE_OP1_ATTACK)
+	{
+		drawCharacterAtPosition(numToHex[op->attackRate], x+5, y, color, COLOR_BLACK);
+		drawCharacterAtPosition(numToHex[op->decayRate], x+6, y, color, COLOR_BLACK);
+	}
 
-				if (targetChannel <= 5 || (targetChannel >= 9 && targetChannel <= 14))
-				{
-					if (oplStatus.channels[targetChannel].flag4Op == 1)
-					{
-						if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
-						{
-							// Block number
-							sprintf(txtDrawBuffer, " %X ", oplStatus.channels[targetChannel].blockNumber);
-							drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+3, COLOR_BROWN, COLOR_BLACK);
-							// Frequency number
-							sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-							drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+4, COLOR_YELLOW, COLOR_BLACK);
-							// Key on
-							drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+5, tempAttribute, COLOR_BLACK);
-						}
-					}
-					else
-					{
-						// Block number
-						sprintf(txtDrawBuffer, " %X ", oplStatus.channels[targetChannel].blockNumber);
-						drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+1, COLOR_BROWN, COLOR_BLACK);
-						// Frequency number
-						sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-						drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2, COLOR_YELLOW, COLOR_BLACK);
-						// Key on
-						drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+3, tempAttribute, COLOR_BLACK);
-					}
-				}
-				// Positioning for 2-op channels
-				else
-				{
-					// Block number
-					sprintf(txtDrawBuffer, " %X ", oplStatus.channels[targetChannel].blockNumber);
-					drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+1, COLOR_BROWN, COLOR_BLACK);
-					// Frequency number
-					sprintf(txtDrawBuffer, "%.3X", oplStatus.channels[targetChannel].frequencyNumber);
-					drawStringAtPosition(txtDrawBuffer,oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2, COLOR_YELLOW, COLOR_BLACK);
-					// Key on
-					drawCharacterAtPosition(tempNoteSymbol, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+1, oplStatus.channels[targetChannel].displayY+3, tempAttribute, COLOR_BLACK);
-				}
+	// Sustain/Release
+	if (fields & DECODE_OP1_SUSTAIN)
+	{
+		drawCharacterAtPosition(numToHex[op->sustainLevel], x+7, y, color, COLOR_BLACK);
+		drawCharacterAtPosition(numToHex[op->releaseRate], x+8, y, color, COLOR_BLACK);
+	}
+}
+
+void drawChannelAlgorithm(uint8_t targetChannel)
+{
+	// Draw Panning (only if the OPL3 is turned on, or playing DualOPL2)
+	if (oplStatus.flagOPL3Mode != 0 || vgmChipType == VGM_DUAL_OPL2)
+	{
+		if (oplStatus.channels[targetChannel].flag4Op == 0)
+		{
+			// Left
+			if ((oplStatus.channels[targetChannel].panning & 0x01) == 1)
+			{
+				drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+3), COLOR_WHITE, COLOR_BLACK);
 			}
-			
-			// Tremolo Depth / Vibrato Depth / Percussion Mode
-			// (Only currently dealing with Percussion Mode)
-			else if (i == 0xBD)
+			else
 			{
-				// Percussion Mode flag
-				oplStatus.flagPercussionMode = (oplRegisterMap[i] >> 5) & 0x01;
-				
-				// Store value of which percussion instruments are keyed-on
-				oplStatus.percussionData = oplRegisterMap[i] & 0x1F;
-				
-				// Based on which percussion is on, turn on the appropriate key-on for channels 7/8/9
-				// We also reset the changeMap to force a redraw of the appropriate section of the table
-				
-				// BD
-				if ((oplStatus.percussionData >> 4) & 0x01 == 1)
+				drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+3), COLOR_DARKGREY, COLOR_BLACK);
+			}
+			// Right
+			if ((oplStatus.channels[targetChannel].panning & 0x02) == 2)
+			{
+				drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+3), COLOR_WHITE, COLOR_BLACK);
+			}
+			else
+			{
+				drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+3), COLOR_DARKGREY, COLOR_BLACK);
+			}
+		}
+		else if (oplStatus.channels[targetChannel].flag4Op != 0)
+		{
+			// Positioning for 4-op channels
+			if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
+			{
+				// Left
+				if ((oplStatus.channels[targetChannel].panning & 0x01) == 1)
 				{
-					oplStatus.channels[6].keyOn = TRUE;
-					oplChangeMap[0xB6] = 1;
+					drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+5), COLOR_WHITE, COLOR_BLACK);
 				}
 				else
 				{
-					oplStatus.channels[6].keyOn = FALSE;
-					oplChangeMap[0xB6] = 1;
+					drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+5), COLOR_DARKGREY, COLOR_BLACK);
 				}
-				
-				// SD & HH
-				if (((oplStatus.percussionData >> 3) & 0x01 == 1) || (oplStatus.percussionData & 0x01 == 1))
+				// Right
+				if ((oplStatus.channels[targetChannel].panning & 0x02) == 2)
 				{
-					oplStatus.channels[7].keyOn = TRUE;
-					oplChangeMap[0xB7] = 1;
+					drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+5), COLOR_WHITE, COLOR_BLACK);
 				}
 				else
 				{
-					oplStatus.channels[7].keyOn = FALSE;
-					oplChangeMap[0xB7] = 1;
-				}				
-				
-				// TT & CY
-				if (((oplStatus.percussionData >> 2) & 0x01 == 1) || ((oplStatus.percussionData >> 1) & 0x01 == 1))
-				{
-					oplStatus.channels[8].keyOn = TRUE;
-					oplChangeMap[0xB8] = 1;
+					drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+5), COLOR_DARKGREY, COLOR_BLACK);
 				}
-				else
-				{
-					oplStatus.channels[8].keyOn = FALSE;
-					oplChangeMap[0xB8] = 1;
-				}		
 			}
+		}
+	}
 
-			// Panning, Feedback, Algorithm
-			else if ((i >= 0xC0 && i <= 0xC8) || (i >= 0x1C0 && i <= 0x1C8))
+	// Draw Algorithm type
+	if (oplStatus.channels[targetChannel].flag4Op == 0)
+	{
+		// FM Algorithm
+		if(oplStatus.channels[targetChannel].synthesisType == 0)
+		{
+			drawGraphicAtPosition(tgAlgoFM, 7, 3, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+		}
+		// AS Algorithm
+		else if (oplStatus.channels[targetChannel].synthesisType == 1)
+		{
+			drawGraphicAtPosition(tgAlgoAS, 7, 3, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+		}
+	}
+	else if (oplStatus.channels[targetChannel].flag4Op != 0)
+	{
+		// Only do this if we are on the first channel of the 4-op pairing
+		if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
+		{
+			// Clean up previously written text from switching between 2/4op
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+2, COLOR_BLACK, COLOR_BLACK);
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+6, COLOR_BLACK, COLOR_BLACK);
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+1, COLOR_BLACK, COLOR_BLACK);
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2, COLOR_BLACK, COLOR_BLACK);
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+6, COLOR_BLACK, COLOR_BLACK);
+			drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+7, COLOR_BLACK, COLOR_BLACK);
+
+			// FM+FM
+			if(oplStatus.channels[targetChannel].synthesisType == 0 && oplStatus.channels[targetChannel+3].synthesisType == 0 )
 			{
-				if (i >= 0xC0 && i <= 0xC8)
-				{
-					targetChannel = i - 0xC0;
-				}
-				else if (i >= 0x1C0 && i <= 0x1C8)
-				{
-					targetChannel = (i - 0x1C0) + 9;
-				}
+				drawGraphicAtPosition(tgAlgoFMFM, 7, 7, oplStatus.channels[targetChannel+3].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+			}
+			// AS+FM
+			else if(oplStatus.channels[targetChannel].synthesisType == 1 && oplStatus.channels[targetChannel+3].synthesisType == 0 )
+			{
+				drawGraphicAtPosition(tgAlgoASFM, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+			}
+			// FM+AS
+			else if(oplStatus.channels[targetChannel].synthesisType == 0 && oplStatus.channels[targetChannel+3].synthesisType == 1 )
+			{
+				drawGraphicAtPosition(tgAlgoFMAS, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+			}
+			// AS+AS
+			else if(oplStatus.channels[targetChannel].synthesisType == 1 && oplStatus.channels[targetChannel+3].synthesisType == 1 )
+			{
+				drawGraphicAtPosition(tgAlgoASAS, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
+			}
+		}
+	}
 
-				// Panning
-				oplStatus.channels[targetChannel].panning = ((oplRegisterMap[i] >> 4) & 0x03);
+	// Draw Feedback
+	if (oplStatus.channels[targetChannel].flag4Op == 0)
+	{
+		drawCellsAtPosition(cellFeedback[oplStatus.channels[targetChannel].feedback], CELLS_FEEDBACK, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24, oplStatus.channels[targetChannel].displayY+2);
 
-				// Algorithm type
-				oplStatus.channels[targetChannel].synthesisType = ((oplRegisterMap[i]) & 0x01);
+	}
+	else if (oplStatus.channels[targetChannel].flag4Op != 0)
+	{
+		if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
+		{
+		drawCellsAtPosition(cellFeedback[oplStatus.channels[targetChannel].feedback], CELLS_FEEDBACK, oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24, oplStatus.channels[targetChannel].displayY+4);
+		}
+	}
+}
 
-				// Feedback
-				oplStatus.channels[targetChannel].feedback = ((oplRegisterMap[i] >> 1) & 0x07);
+void drawChannelLayout(void)
+{
+	uint8_t j;
+	uint8_t k;
 
-				// Draw Panning (only if the OPL3 is turned on, or playing DualOPL2)
-				if (oplStatus.flagOPL3Mode != 0 || vgmChipType == VGM_DUAL_OPL2)
-				{
-					if (oplStatus.channels[targetChannel].flag4Op == 0)
-					{
-						// Left
-						if ((oplStatus.channels[targetChannel].panning & 0x01) == 1)
-						{
-							drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+3), COLOR_WHITE, COLOR_BLACK);
-						}
-						else
-						{
-							drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+3), COLOR_DARKGREY, COLOR_BLACK);
-						}
-						// Right
-						if ((oplStatus.channels[targetChannel].panning & 0x02) == 2)
-						{
-							drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+3), COLOR_WHITE, COLOR_BLACK);
-						}
-						else
-						{
-							drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+3), COLOR_DARKGREY, COLOR_BLACK);
-						}
-					}
-					else if (oplStatus.channels[targetChannel].flag4Op != 0)
-					{
-						// Positioning for 4-op channels
-						if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
-						{
-							// Left
-							if ((oplStatus.channels[targetChannel].panning & 0x01) == 1)
-							{
-								drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+5), COLOR_WHITE, COLOR_BLACK);
-							}
-							else
-							{
-								drawCharacterAtPosition('(', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO, (oplStatus.channels[targetChannel].displayY+5), COLOR_DARKGREY, COLOR_BLACK);
-							}
-							// Right
-							if ((oplStatus.channels[targetChannel].panning & 0x02) == 2)
-							{
-								drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+5), COLOR_WHITE, COLOR_BLACK);
-							}
-							else
-							{
-								drawCharacterAtPosition(')', oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO+2, (oplStatus.channels[targetChannel].displayY+5), COLOR_DARKGREY, COLOR_BLACK);
-							}
-						}
-					}
-				}
+	// After changing 4-op flags, force redraw of things that may need repositioning or changed
 
-				// Draw Algorithm type
-				if (oplStatus.channels[targetChannel].flag4Op == 0)
-				{
-					// FM Algorithm
-					if(oplStatus.channels[targetChannel].synthesisType == 0)
-					{
-						drawGraphicAtPosition(tgAlgoFM, 7, 3, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-					}
-					// AS Algorithm
-					else if (oplStatus.channels[targetChannel].synthesisType == 1)
-					{
-						drawGraphicAtPosition(tgAlgoAS, 7, 3, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-					}
-				}
-				else if (oplStatus.channels[targetChannel].flag4Op != 0)
-				{
-					// Only do this if we are on the first channel of the 4-op pairing
-					if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
-					{
-						// Clean up previously written text from switching between 2/4op
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+2, COLOR_BLACK, COLOR_BLACK);
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+6, COLOR_BLACK, COLOR_BLACK);
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+1, COLOR_BLACK, COLOR_BLACK);
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+2, COLOR_BLACK, COLOR_BLACK);
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+6, COLOR_BLACK, COLOR_BLACK);
-						drawStringAtPosition("   ",oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_CHANNEL_NOTEINFO,oplStatus.channels[targetChannel].displayY+7, COLOR_BLACK, COLOR_BLACK);
-
-						// FM+FM
-						if(oplStatus.channels[targetChannel].synthesisType == 0 && oplStatus.channels[targetChannel+3].synthesisType == 0 )
-						{
-							drawGraphicAtPosition(tgAlgoFMFM, 7, 7, oplStatus.channels[targetChannel+3].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-						}
-						// AS+FM
-						else if(oplStatus.channels[targetChannel].synthesisType == 1 && oplStatus.channels[targetChannel+3].synthesisType == 0 )
-						{
-							drawGraphicAtPosition(tgAlgoASFM, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-						}
-						// FM+AS
-						else if(oplStatus.channels[targetChannel].synthesisType == 0 && oplStatus.channels[targetChannel+3].synthesisType == 1 )
-						{
-							drawGraphicAtPosition(tgAlgoFMAS, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-						}
-						// AS+AS
-						else if(oplStatus.channels[targetChannel].synthesisType == 1 && oplStatus.channels[targetChannel+3].synthesisType == 1 )
-						{
-							drawGraphicAtPosition(tgAlgoASAS, 7, 7, oplStatus.channels[targetChannel].displayX+1, oplStatus.channels[targetChannel].displayY+1);
-						}
-					}
-				}
+	// Recalculate Y positions of channels
+	// Go in channel number order if we are in 2-op
+	if (oplStatus.channels[0].flag4Op == FALSE && oplStatus.channels[1].flag4Op == FALSE && oplStatus.channels[2].flag4Op == FALSE && oplStatus.channels[9].flag4Op == FALSE && oplStatus.channels[10].flag4Op == FALSE && oplStatus.channels[11].flag4Op == FALSE)
+	{
+		// Set default Y positions for channels (2-op in-order)
+		for (j=0; j<18; j++)
+		{
+			if (j < 9)
+			{
+				oplStatus.channels[j].displayY = CHAN_TABLE_START_Y+(j*4);
+			}
+			else
+			{
+				oplStatus.channels[j].displayY = CHAN_TABLE_START_Y+((j-9)*4);				
+			}
+		}
+		// Change level bar X positions
+		adsrSim[0].xPos = (CHAN_TABLE_START_X+7);
+		adsrSim[1].xPos = (CHAN_TABLE_START_X+7)+3;
+		adsrSim[2].xPos = (CHAN_TABLE_START_X+7)+6;
+		adsrSim[3].xPos = (CHAN_TABLE_START_X+7)+9;
+		adsrSim[4].xPos = (CHAN_TABLE_START_X+7)+12;
+		adsrSim[5].xPos = (CHAN_TABLE_START_X+7)+15;
+		adsrSim[9].xPos = (CHAN_TABLE_START_X+47);
+		adsrSim[10].xPos = (CHAN_TABLE_START_X+47)+3;
+		adsrSim[11].xPos = (CHAN_TABLE_START_X+47)+6;
+		adsrSim[12].xPos = (CHAN_TABLE_START_X+47)+9;
+		adsrSim[13].xPos = (CHAN_TABLE_START_X+47)+12;
+		adsrSim[14].xPos = (CHAN_TABLE_START_X+47)+15;
+
+		// Cleanup empty space between channel bars
+		for (j=0; j<18; j++)
+		{
+			drawLevelBar(tgLevelBars, 15, adsrSim[j].xPos+2, CHAN_BARS_START_Y, 1);
+		}
 
-				// Draw Feedback
-				if (oplStatus.channels[targetChannel].flag4Op == 0)
-				{
-					drawStringAtPosition(oplFeedbackNames[oplStatus.channels[targetChannel].feedback],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+2, COLOR_YELLOW, COLOR_BLACK);
 
-				}
-				else if (oplStatus.channels[targetChannel].flag4Op != 0)
-				{
-					if (targetChannel <= 2 || (targetChannel >= 9 && targetChannel <= 11))
-					{
-					drawStringAtPosition(oplFeedbackNames[oplStatus.channels[targetChannel].feedback],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS+24,oplStatus.channels[targetChannel].displayY+4, COLOR_YELLOW, COLOR_BLACK);
-					}
-				}
+	}
+	// If any channels switch to 4-op, use the 4-op ordering
+	if (oplStatus.channels[0].flag4Op == TRUE || oplStatus.channels[1].flag4Op == TRUE || oplStatus.channels[2].flag4Op == TRUE || oplStatus.channels[9].flag4Op == TRUE || oplStatus.channels[10].flag4Op == TRUE || oplStatus.channels[11].flag4Op == TRUE)
+	{
+		oplStatus.channels[0].displayY = CHAN_TABLE_START_Y;
+		oplStatus.channels[3].displayY = CHAN_TABLE_START_Y+4;
+		oplStatus.channels[1].displayY = CHAN_TABLE_START_Y+8;
+		oplStatus.channels[4].displayY = CHAN_TABLE_START_Y+12;
+		oplStatus.channels[2].displayY = CHAN_TABLE_START_Y+16;
+		oplStatus.channels[5].displayY = CHAN_TABLE_START_Y+20;
+		oplStatus.channels[9].displayY = CHAN_TABLE_START_Y;
+		oplStatus.channels[12].displayY = CHAN_TABLE_START_Y+4;
+		oplStatus.channels[10].displayY = CHAN_TABLE_START_Y+8;
+		oplStatus.channels[13].displayY = CHAN_TABLE_START_Y+12;
+		oplStatus.channels[11].displayY = CHAN_TABLE_START_Y+16;
+		oplStatus.channels[14].displayY = CHAN_TABLE_START_Y+20;
+
+		// Change level bar X positions
+		adsrSim[0].xPos = CHAN_BARS_START_X;
+		adsrSim[3].xPos = CHAN_BARS_START_X+3;
+		adsrSim[1].xPos = CHAN_BARS_START_X+6;
+		adsrSim[4].xPos = CHAN_BARS_START_X+9;
+		adsrSim[2].xPos = CHAN_BARS_START_X+12;
+		adsrSim[5].xPos = CHAN_BARS_START_X+15;
+		adsrSim[9].xPos = (CHAN_BARS_START_X+40);
+		adsrSim[12].xPos = (CHAN_BARS_START_X+40)+3;
+		adsrSim[10].xPos = (CHAN_BARS_START_X+40)+6;
+		adsrSim[13].xPos = (CHAN_BARS_START_X+40)+9;
+		adsrSim[11].xPos = (CHAN_BARS_START_X+40)+12;
+		adsrSim[14].xPos = (CHAN_BARS_START_X+40)+15;
+
+		// Cleanup empty space between channel bars
+		for (j=0; j<18; j++)
+		{
+			if (oplStatus.channels[j].flag4Op == FALSE)
+			{
+				drawLevelBar(tgLevelBars, 15, adsrSim[j].xPos+2, CHAN_BARS_START_Y, 1);
 			}
+		}
+	}
 
-			// Waveform Select
-			else if ((i >= 0xE0 && i <= 0xF5) || (i >= 0x1E0 && i <= 0x1F5))
+	// Force a cleanup of values - everything in the channels that could have moved, so nothing's left where they used to be
+	for (j = 0; j <= 5; j++)
+	{
+		decodeMarkChannel(j, DECODE_ALL_FIELDS);
+		decodeMarkChannel(j+9, DECODE_ALL_FIELDS);
+	}
+
+	// Channel names
+	for (j=0; j < maxChannels; j++)
+	{
+		// Rename 4-op channels
+		if (j <=2 || (j >= 9 && j <= 11))
+		{
+
+			if (oplStatus.channels[j].flag4Op == 1)
 			{
-				if (i >= 0xE0 && i <= 0xF5)
+				drawStringAtPosition("4OP", oplStatus.channels[j].displayX+36, oplStatus.channels[j].displayY, COLOR_LIGHTRED, COLOR_BLACK);
+				if (j == 0)
 				{
-					targetChannel = oplOperatorToChannel[(i - 0xE0)];
-					targetOperator = oplOffsetToOperator[(i - 0xE0)];
+					drawStringAtPosition("01+04", oplStatus.channels[0].displayX+2, oplStatus.channels[0].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
-				else if (i >= 0x1E0 && i <= 0x1F5)
+				else if (j == 1)
 				{
-					targetChannel = oplOperatorToChannel[(i - 0x1E0)] + 9;
-					targetOperator = oplOffsetToOperator[(i - 0x1E0)];
+					drawStringAtPosition("02+05", oplStatus.channels[1].displayX+2, oplStatus.channels[1].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
-
-				// If OPL2, ignore the highest bit as those waveforms can't be used
-				if (oplStatus.flagOPL3Mode == 0)
+				else if (j == 2)
 				{
-					oplStatus.channels[targetChannel].operators[targetOperator].waveform = (oplRegisterMap[i] & 0x03);
+					drawStringAtPosition("03+06", oplStatus.channels[2].displayX+2, oplStatus.channels[2].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
-				else
+				else if (j == 9)
 				{
-					oplStatus.channels[targetChannel].operators[targetOperator].waveform = (oplRegisterMap[i] & 0x07);
+					drawStringAtPosition("10+13", oplStatus.channels[9].displayX+2, oplStatus.channels[9].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
-
-				if (targetOperator == 0)
+				else if (j == 10)
 				{
-					drawStringAtPosition(oplWaveformNames[oplStatus.channels[targetChannel].operators[targetOperator].waveform],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS,oplStatus.channels[targetChannel].displayY+1, COLOR_LIGHTCYAN, COLOR_BLACK);
+					drawStringAtPosition("11+14", oplStatus.channels[10].displayX+2, oplStatus.channels[10].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
-				else if (targetOperator == 1)
+				else if (j == 11)
 				{
-					drawStringAtPosition(oplWaveformNames[oplStatus.channels[targetChannel].operators[targetOperator].waveform],oplStatus.channels[targetChannel].displayX+CHAN_DISP_OFFSET_OPERATOR_PARAMETERS,oplStatus.channels[targetChannel].displayY+3, COLOR_LIGHTGREEN, COLOR_BLACK);
+					drawStringAtPosition("12+15", oplStatus.channels[11].displayX+2, oplStatus.channels[11].displayY, COLOR_WHITE, COLOR_BLACK);
 				}
 			}
-
-			// OPL3 4-op flags
-			else if (i == 0x104)
+		}
+		// Channel has reverted to 2-op - need to redraw the paired channels too
+		if ( j <=5 || (j >= 9 && j <= 14))
+		{
+			if (oplStatus.channels[j].flag4Op == 0)
 			{
-				oplStatus.channels[0].flag4Op = (oplRegisterMap[0x104] & 0x01);
-				oplStatus.channels[3].flag4Op = (oplRegisterMap[0x104] & 0x01);
-				oplStatus.channels[1].flag4Op = (oplRegisterMap[0x104] & 0x02) >> 1;
-				oplStatus.channels[4].flag4Op = (oplRegisterMap[0x104] & 0x02) >> 1;
-				oplStatus.channels[2].flag4Op = (oplRegisterMap[0x104] & 0x04) >> 2;
-				oplStatus.channels[5].flag4Op = (oplRegisterMap[0x104] & 0x04) >> 2;
-				oplStatus.channels[9].flag4Op = (oplRegisterMap[0x104] & 0x08) >> 3;
-				oplStatus.channels[12].flag4Op = (oplRegisterMap[0x104] & 0x08) >> 3;
-				oplStatus.channels[10].flag4Op = (oplRegisterMap[0x104] & 0x10) >> 4;
-				oplStatus.channels[13].flag4Op = (oplRegisterMap[0x104] & 0x10) >> 4;
-				oplStatus.channels[11].flag4Op = (oplRegisterMap[0x104] & 0x20) >> 5;
-				oplStatus.channels[14].flag4Op = (oplRegisterMap[0x104] & 0x20) >> 5;
-
-				// After changing 4-op flags, force redraw of things that may need repositioning or changed
-				
-				// Recalculate Y positions of channels
-				// Go in channel number order if we are in 2-op
-				if (oplStatus.channels[0].flag4Op == FALSE && oplStatus.channels[1].flag4Op == FALSE && oplStatus.channels[2].flag4Op == FALSE && oplStatus.channels[9].flag4Op == FALSE && oplStatus.channels[10].flag4Op == FALSE && oplStatus.channels[11].flag4Op == FALSE)
-				{
-					// Set default Y positions for channels (2-op in-order)
-					for (j=0; j<18; j++)
-					{
-						if (j < 9)
-						{
-							oplStatus.channels[j].displayY = CHAN_TABLE_START_Y+(j*4);
-						}
-						else
-						{
-							oplStatus.channels[j].displayY = CHAN_TABLE_START_Y+((j-9)*4);				
-						}
-					}
-					// Change level bar X positions
-					adsrSim[0].xPos = (CHAN_TABLE_START_X+7);
-					adsrSim[1].xPos = (CHAN_TABLE_START_X+7)+3;
-					adsrSim[2].xPos = (CHAN_TABLE_START_X+7)+6;
-					adsrSim[3].xPos = (CHAN_TABLE_START_X+7)+9;
-					adsrSim[4].xPos = (CHAN_TABLE_START_X+7)+12;
-					adsrSim[5].xPos = (CHAN_TABLE_START_X+7)+15;
-					adsrSim[9].xPos = (CHAN_TABLE_START_X+47);
-					adsrSim[10].xPos = (CHAN_TABLE_START_X+47)+3;
-					adsrSim[11].xPos = (CHAN_TABLE_START_X+47)+6;
-					adsrSim[12].xPos = (CHAN_TABLE_START_X+47)+9;
-					adsrSim[13].xPos = (CHAN_TABLE_START_X+47)+12;
-					adsrSim[14].xPos = (CHAN_TABLE_START_X+47)+15;
-					
-					// Cleanup empty space between channel bars
-					for (j=0; j<18; j++)
-					{
-						drawLevelBar(tgLevelBars, 15, adsrSim[j].xPos+2, CHAN_BARS_START_Y, 1);
-					}
-					
-					
-				}
-				// If any channels switch to 4-op, use the 4-op ordering
-				if (oplStatus.channels[0].flag4Op == TRUE || oplStatus.channels[1].flag4Op == TRUE || oplStatus.channels[2].flag4Op == TRUE || oplStatus.channels[9].flag4Op == TRUE || oplStatus.channels[10].flag4Op == TRUE || oplStatus.channels[11].flag4Op == TRUE)
-				{
-					oplStatus.channels[0].displayY = CHAN_TABLE_START_Y;
-					oplStatus.channels[3].displayY = CHAN_TABLE_START_Y+4;
-					oplStatus.channels[1].displayY = CHAN_TABLE_START_Y+8;
-					oplStatus.channels[4].displayY = CHAN_TABLE_START_Y+12;
-					oplStatus.channels[2].displayY = CHAN_TABLE_START_Y+16;
-					oplStatus.channels[5].displayY = CHAN_TABLE_START_Y+20;
-					oplStatus.channels[9].displayY = CHAN_TABLE_START_Y;
-					oplStatus.channels[12].displayY = CHAN_TABLE_START_Y+4;
-					oplStatus.channels[10].displayY = CHAN_TABLE_START_Y+8;
-					oplStatus.channels[13].displayY = CHAN_TABLE_START_Y+12;
-					oplStatus.channels[11].displayY = CHAN_TABLE_START_Y+16;
-					oplStatus.channels[14].displayY = CHAN_TABLE_START_Y+20;
-					
-					// Change level bar X positions
-					adsrSim[0].xPos = CHAN_BARS_START_X;
-					adsrSim[3].xPos = CHAN_BARS_START_X+3;
-					adsrSim[1].xPos = CHAN_BARS_START_X+6;
-					adsrSim[4].xPos = CHAN_BARS_START_X+9;
-					adsrSim[2].xPos = CHAN_BARS_START_X+12;
-					adsrSim[5].xPos = CHAN_BARS_START_X+15;
-					adsrSim[9].xPos = (CHAN_BARS_START_X+40);
-					adsrSim[12].xPos = (CHAN_BARS_START_X+40)+3;
-					adsrSim[10].xPos = (CHAN_BARS_START_X+40)+6;
-					adsrSim[13].xPos = (CHAN_BARS_START_X+40)+9;
-					adsrSim[11].xPos = (CHAN_BARS_START_X+40)+12;
-					adsrSim[14].xPos = (CHAN_BARS_START_X+40)+15;
-					
-					// Cleanup empty space between channel bars
-					for (j=0; j<18; j++)
-					{
-						if (oplStatus.channels[j].flag4Op == FALSE)
-						{
-							drawLevelBar(tgLevelBars, 15, adsrSim[j].xPos+2, CHAN_BARS_START_Y, 1);
-						}
-					}
-				}
-
-				// Force a cleanup of values
-				// 0xAx Frequency (Low)
-				// 0xBx Key-On / Block / Frequency (High)
-				// 0xCx Algorithm / Feedback / Panning
-				for (j = 0x00; j <= 0x05; j++)
-				{
-					oplChangeMap[0xA0+j] = 1;
-					oplChangeMap[0xB0+j] = 1;
-					oplChangeMap[0xC0+j] = 1;
-				}
-				for (j = 0x00; j <= 0x05; j++)
-				{
-					oplChangeMap[0x1A0+j] = 1;
-					oplChangeMap[0x1B0+j] = 1;
-					oplChangeMap[0x1C0+j] = 1;
-				}
 
-				// Channel names
-				for (j=0; j < maxChannels; j++)
-				{
-					// Rename 4-op channels
-					if (j <=2 || (j >= 9 && j <= 11))
-					{
-
-						if (oplStatus.channels[j].flag4Op == 1)
-						{
-							drawStringAtPosition("4OP", oplStatus.channels[j].displayX+36, oplStatus.channels[j].displayY, COLOR_LIGHTRED, COLOR_BLACK);
-							if (j == 0)
-							{
-								drawStringAtPosition("01+04", oplStatus.channels[0].displayX+2, oplStatus.channels[0].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-							else if (j == 1)
-							{
-								drawStringAtPosition("02+05", oplStatus.channels[1].displayX+2, oplStatus.channels[1].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-							else if (j == 2)
-							{
-								drawStringAtPosition("03+06", oplStatus.channels[2].displayX+2, oplStatus.channels[2].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-							else if (j == 9)
-							{
-								drawStringAtPosition("10+13", oplStatus.channels[9].displayX+2, oplStatus.channels[9].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-							else if (j == 10)
-							{
-								drawStringAtPosition("11+14", oplStatus.channels[10].displayX+2, oplStatus.channels[10].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-							else if (j == 11)
-							{
-								drawStringAtPosition("12+15", oplStatus.channels[11].displayX+2, oplStatus.channels[11].displayY, COLOR_WHITE, COLOR_BLACK);
-							}
-						}
-					}
-					// Channel has reverted to 2-op - need to redraw the paired channels too
-					if ( j <=5 || (j >= 9 && j <= 14))
-					{
-						if (oplStatus.channels[j].flag4Op == 0)
-						{
+				drawCellsAtPosition(cellChannelName[j], CELLS_CHANNEL_NAME, oplStatus.channels[j].displayX+2, oplStatus.channels[j].displayY);
+				drawStringAtPosition("\xCD\xCD\xCD", oplStatus.channels[j].displayX+36, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
+			}
+		}
+	}
+	// Redraw lines 'n stuff
+	for (j=0; j < maxChannels; j++)
+	{
 
-							sprintf(txtDrawBuffer, "Ch.%02d", j+1);
-							drawStringAtPosition(txtDrawBuffer, oplStatus.channels[j].displayX+2, oplStatus.channels[j].displayY, COLOR_WHITE, COLOR_BLACK);
-							drawStringAtPosition("\xCD\xCD\xCD", oplStatus.channels[j].displayX+36, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-						}
-					}
+		// Channel headers (for channels that can switch between 2op and 4op)
+		if (j < 3 || (j > 5 && j < 12) || j > 14)
+		{
+			for (k=1; k<36; k++)
+			{
+				// Skip the channel number location
+				if ( k<2 || k>6 )
+				{	// Draw horizontal line
+					drawCharacterAtPosition(CHAR_BOX_DOUBLE_HORIZONTAL, oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
 				}
-				// Redraw lines 'n stuff
-				for (j=0; j < maxChannels; j++)
+			}
+			// Draw corner pieces
+			drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_RIGHT_DOUBLE, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
+			drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_LEFT_DOUBLE, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
+			// Clear extra characters that may have been left behind in 2-op mode
+			if (oplStatus.channels[j].flag4Op == 1)
+			{
+				drawCharacterAtPosition(CHAR_BOX_SINGLE_VERTICAL, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY+4, COLOR_DARKGREY, COLOR_BLACK);
+				drawCharacterAtPosition(CHAR_BOX_SINGLE_VERTICAL, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY+4, COLOR_DARKGREY, COLOR_BLACK);
+				for (k=8; k<33; k++)
 				{
-
-					// Channel headers (for channels that can switch between 2op and 4op)
-					if (j < 3 || (j > 5 && j < 12) || j > 14)
-					{
-						for (k=1; k<36; k++)
-						{
-							// Skip the channel number location
-							if ( k<2 || k>6 )
-							{	// Draw horizontal line
-								drawCharacterAtPosition(CHAR_BOX_DOUBLE_HORIZONTAL, oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-							}
-						}
-						// Draw corner pieces
-						drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_RIGHT_DOUBLE, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-						drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_LEFT_DOUBLE, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-						// Clear extra characters that may have been left behind in 2-op mode
-						if (oplStatus.channels[j].flag4Op == 1)
-						{
-							drawCharacterAtPosition(CHAR_BOX_SINGLE_VERTICAL, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY+4, COLOR_DARKGREY, COLOR_BLACK);
-							drawCharacterAtPosition(CHAR_BOX_SINGLE_VERTICAL, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY+4, COLOR_DARKGREY, COLOR_BLACK);
-							for (k=8; k<33; k++)
-							{
-								drawCharacterAtPosition(' ', oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY+4, COLOR_BLACK, COLOR_BLACK);
-							}
-							drawCharacterAtPosition(' ', oplStatus.channels[j].displayX+35, oplStatus.channels[j].displayY+4, COLOR_BLACK, COLOR_BLACK);
-						}
-
-					}
-					// Channel headers (2op channels)
-					else
-					{
-						if (oplStatus.channels[j].flag4Op == 0)
-						{
-							for (k=1; k<36; k++)
-							{
-								// Skip the channel number location
-								if ( k<2 || k>6 )
-								{
-									// Draw horizontal line
-									drawCharacterAtPosition(CHAR_BOX_DOUBLE_HORIZONTAL, oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-								}
-							}
-							// Draw corner pieces
-							drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_RIGHT_DOUBLE, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-							drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_LEFT_DOUBLE, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
-						}
-					}
+					drawCharacterAtPosition(' ', oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY+4, COLOR_BLACK, COLOR_BLACK);
 				}
+				drawCharacterAtPosition(' ', oplStatus.channels[j].displayX+35, oplStatus.channels[j].displayY+4, COLOR_BLACK, COLOR_BLACK);
 			}
 
-			// OPL3 "new bit"
-			else if (i == 0x105)
+		}
+		// Channel headers (2op channels)
+		else
+		{
+			if (oplStatus.channels[j].flag4Op == 0)
 			{
-				oplStatus.flagOPL3Mode = (oplRegisterMap[0x105] & 0x01);
-
-				// Force redraw panning
-				for (j = 0x00; j <= 0x08; j++)
+				for (k=1; k<36; k++)
 				{
-					oplChangeMap[0xC0+j] = 1;
-				}
-				for (j = 0x00; j <= 0x08; j++)
-				{
-					oplChangeMap[0x1C0+j] = 1;
+					// Skip the channel number location
+					if ( k<2 || k>6 )
+					{
+						// Draw horizontal line
+						drawCharacterAtPosition(CHAR_BOX_DOUBLE_HORIZONTAL, oplStatus.channels[j].displayX+k, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
+					}
 				}
+				// Draw corner pieces
+				drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_RIGHT_DOUBLE, oplStatus.channels[j].displayX, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
+				drawCharacterAtPosition(CHAR_BOX_DOWN_SINGLE_LEFT_DOUBLE, oplStatus.channels[j].displayX+39, oplStatus.channels[j].displayY, COLOR_DARKGREY, COLOR_BLACK);
 			}
-
-			// End of processing, this byte has been handled
-			oplChangeMap[i] = 0;
 		}
 	}
-
-	for (i = 0; i < maxChannels; i++)
-	{
-	
-	}
-	
-	// Draw operation is done
-	requestScreenDraw = 0;
 }
 
 void updateLevelBars(void)
@@ -1148,6 +903,12 @@ void drawTextUI(void)
 	}
 	sprintf(txtDrawBuffer, "VGMSlap! %s", VGMSLAP_VERSION);
 	drawStringAtPosition(txtDrawBuffer,0,0,COLOR_WHITE,COLOR_BLUE);
+	// Which chip the channel display is showing, when there's more than one
+	if (oplChipCount > 1)
+	{
+		sprintf(txtDrawBuffer, "Chip %u/%u", oplDisplayChip + 1, oplChipCount);
+		drawStringAtPosition(txtDrawBuffer,32,0,COLOR_YELLOW,COLOR_BLUE);
+	}
 	if (playlistMode == FALSE)
 	{
 		drawStringAtPosition("Now playing:             ",55,0,COLOR_WHITE,COLOR_BLUE);
@@ -1220,8 +981,7 @@ void drawTextUI(void)
 		for (i=0; i<maxChannels; i++)
 		{
 			// Initial channel numbers
-			sprintf(txtDrawBuffer, "Ch.%02d", i+1);
-			drawStringAtPosition(txtDrawBuffer, oplStatus.channels[i].displayX+2, oplStatus.channels[i].displayY, COLOR_WHITE, COLOR_BLACK);
+			drawCellsAtPosition(cellChannelName[i], CELLS_CHANNEL_NAME, oplStatus.channels[i].displayX+2, oplStatus.channels[i].displayY);
 			drawStringAtPosition("\xCD\xCD\xCD", oplStatus.channels[i].displayX+36, oplStatus.channels[i].displayY, COLOR_DARKGREY, COLOR_BLACK);
 
 			// Initial horizontal lines
@@ -1365,6 +1125,26 @@ void inputHandler (void)
 		}
 		keyboardPrevious = keyboardCurrent;
 
+		// C - Show the other chip (dual OPL3 only)
+		if ((keyboardCurrent == 0x43 || keyboardCurrent == 0x63) && oplChipCount > 1)
+		{
+			selectOPLDisplayChip((oplDisplayChip + 1) % oplChipCount);
+			sprintf(txtDrawBuffer, "Chip %u/%u", oplDisplayChip + 1, oplChipCount);
+			drawStringAtPosition(txtDrawBuffer,32,0,COLOR_YELLOW,COLOR_BLUE);
+		}
+
+		// P - Pause/resume
+		if (keyboardCurrent == 0x50 || keyboardCurrent == 0x70)
+		{
+			togglePause();
+		}
+
+		// T - Start/stop recording a register trace
+		if (keyboardCurrent == 0x54 || keyboardCurrent == 0x74)
+		{
+			traceToggle();
+		}
+
 		// Esc - Quit
 		if (keyboardCurrent == 0x1B)
 		{
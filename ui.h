@@ -24,8 +24,13 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 void clearInterface(void);		// Clear text screen, but only certain parts of the UI
-void drawChannelTable(void);	// Reads OPL values, packs them into the structs, then draws the result to the screen
-								// (Only interprets and draws parts that change)
+void drawChannelTable(uint32_t budget);	// Decodes any OPL changes into the structs (see decode.c), then draws the result to the screen
+								// Stops after budget ticks (0 = no limit) and leaves the rest for next time, key-ons first
+								// (Only draws parts that change)
+void drawChannelFields(uint8_t targetChannel, uint16_t fields);	// Draw the DECODE_* fields of one channel
+void drawOperatorFields(uint8_t targetChannel, uint8_t targetOperator, uint16_t fields);	// Draw the DECODE_OP1_* fields of one of a channel's operators
+void drawChannelAlgorithm(uint8_t targetChannel);	// Draw panning, algorithm and feedback of one channel
+void drawChannelLayout(void);	// Move channels around after the 4-op pairings change, and redraw their headers
 void updateLevelBars(void);		// Draws level bars using interpreted values - done on global timer
 void drawTextUI(void);			// Draws the static UI components
 void inputHandler(void);		// Reads and acts upon keyboard commands
@@ -38,6 +43,11 @@ extern uint8_t keyboardCurrent;			// Current keycode from getch()
 extern uint8_t keyboardPrevious;		// Last processed keypress, to help identify a "new" vs "repeated" key
 extern uint8_t keyboardExtendedFlag;	// Flag for if we are reading an extended keycode
 extern uint8_t requestScreenDraw;		// Set to 1 when the screen needs to redraw
+extern uint32_t drawPasses;				// How many times drawChannelTable has run
+extern uint32_t drawChannelUpdates;		// How many times it has redrawn a channel
+extern uint32_t drawFramesDrawn;		// How many screen refreshes the channel table was drawn in
+extern uint32_t drawFramesSkipped;		// How many screen refreshes went by with the main loop too busy to draw
+extern uint32_t drawBudgetOverruns;		// How many times the channel table ran out of time and left some for the next refresh
 
 ///////////////////////////////////////////////////////////////////////////////
 // Struct declarations
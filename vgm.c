@@ -18,11 +18,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "fifo.h"
 #include "opl.h"
 #include "settings.h"
 #include "timer.h"
+#include "trace.h"
 #include "vgm.h"
 #include "vgmslap.h"
+#include "xlat.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Initialize variables
@@ -48,6 +51,64 @@ gd3Tag currentGD3Tag;
 // Functions
 ///////////////////////////////////////////////////////////////////////////////
 
+uint8_t decodeCommandWrite(uint16_t* reg, uint8_t* data)
+{
+	uint8_t chip = xlatCommandChip[(uint8_t)commandID];
+	xlatEntry *entry;
+
+	// Waits and everything else we don't play
+	if (chip == XLAT_NOT_OPL)
+	{
+		return 0;
+	}
+	// Everything about getting this write onto our chip (which bank, panning, writes to leave out) was worked out by xlatBuild when the VGM loaded
+	entry = &xlatTable[chip][commandReg];
+	if (entry->drop == TRUE)
+	{
+		return 0;
+	}
+	*reg = entry->reg;
+	*data = (commandData & entry->andMask) | entry->orMask;
+	return 1;
+}
+
+void fillEventQueue(void)
+{
+	uint16_t reg;
+	uint8_t data;
+
+	// Decode commands into the queue until we are far enough ahead of the timer.
+	// The timer interrupt takes care of actually sending them once their sample comes up.
+	while (eventQueueEndOfData == FALSE && dataCurrentSample < (tickCounter + EVENT_QUEUE_LOOKAHEAD))
+	{
+		// No room - try again next time around the main loop
+		if (eventQueueFull())
+		{
+			eventQueueFullStalls++;
+			break;
+		}
+		if (readNextCommand() != 0 || programState == STATE_END_OF_SONG)
+		{
+			// Out of song data, but the interrupt still has queued writes to play out.
+			// Hold off on ending the song until it's done.
+			eventQueueEndOfData = TRUE;
+			programState = STATE_PLAYING;
+			break;
+		}
+		// Write commands don't move dataCurrentSample, so it's exactly the sample this write is due on
+		if (decodeCommandWrite(&reg, &data) != 0)
+		{
+			pushEvent(dataCurrentSample, reg, data);
+		}
+	}
+
+	// Everything has been played, now we can really end the song
+	if (eventQueueEndOfData == TRUE && eventQueueEmpty())
+	{
+		programState = STATE_END_OF_SONG;
+	}
+}
+
 uint8_t getNextCommandData(void)
 {
 	uint32_t currentWait = 0;
@@ -409,14 +470,18 @@ uint8_t getNextCommandData(void)
 			vgmReadBytes(2);
 			break;
 
-		// YMF262 port 0 write value to register (second chip) (skip 2 bytes)
+		// YMF262 port 0 write value to register (second chip)
 		case 0xAE:
 			vgmReadBytes(2);
+			commandReg = vgmFileBuffer[0];
+			commandData = vgmFileBuffer[1];
 			break;
 
-		// YMF262 port 1 write value to register (second chip) (skip 2 bytes)
+		// YMF262 port 1 write value to register (second chip)
 		case 0xAF:
 			vgmReadBytes(2);
+			commandReg = vgmFileBuffer[0];
+			commandData = vgmFileBuffer[1];
 			break;
 
 		// RF5C68 write value to register (skip 2 bytes)
@@ -884,9 +949,9 @@ uint8_t loadVGM(void)
 		// OK, it's OPL3.  Is it dual OPL3?
 		if (currentVGMHeader.ymf262Clock > 0x40000000)
 		{
-			// That's a problem (for now).  Let's back out.  Might look into supporting it later, but I can't test it.
-			// Not even taking into account how the hell to display all that info on screen.
-			vgmChipType = VGM_NO_OPL;
+			// No card has two OPL3s, but the emulator can run them.  The display shows one at a time.
+			vgmChipType = VGM_DUAL_OPL3;
+			maxChannels = 18;
 		}
 		// No, it's single OPL3.
 		else
@@ -903,94 +968,14 @@ uint8_t loadVGM(void)
 	}
 
 	// Chip check was ok.  Now compare vs detected OPL chip to see if it's playable, and if not, kill the program.  We also setup the base IO due to Dual OPL2 shenanigans
-	switch (vgmChipType)
+	if (xlatBaseOffset[vgmChipType][detectedChip] == XLAT_UNSUPPORTED)
 	{
-		// OPL1
-		case VGM_SINGLE_OPL1:
-			if (detectedChip == DETECTED_OPL2 || detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				break;
-			}
-			// If Dual OPL2 was detected we secretly shift the base IO to base+8 so that single OPL2 goes to both stereo channels
-			else if (detectedChip == DETECTED_DUAL_OPL2)
-			{
-				oplBaseAddr = settings.oplBase+8;
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
-		// OPL2
-		case VGM_SINGLE_OPL2:
-			if (detectedChip == DETECTED_OPL2 || detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				break;
-			}
-			// If Dual OPL2 was detected we secretly shift the base IO to base+8 so that single OPL2 goes to both stereo channels
-			else if (detectedChip == DETECTED_DUAL_OPL2)
-			{
-				oplBaseAddr = settings.oplBase+8;
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
-		// OPL3
-		case VGM_SINGLE_OPL3:
-			if (detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
-		// Dual OPL1
-		case VGM_DUAL_OPL1:
-			if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
-		// Dual OPL2
-		case VGM_DUAL_OPL2:
-			if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
-		// OPL1 + OPL2 (Haven't bothered to work on this yet)
-		case VGM_OPL1_OPL2:
-			if (detectedChip == DETECTED_DUAL_OPL2 || detectedChip == DETECTED_OPL3)
-			{
-				oplBaseAddr = settings.oplBase;
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS); // Remove this when feature is ready
-				break;
-			}
-			else
-			{
-				killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
-				break;
-			}
+		killProgram(ERROR_VGM_NO_SUPPORTED_CHIPS);
 	}
+	oplBaseAddr = settings.oplBase + xlatBaseOffset[vgmChipType][detectedChip];
+
+	// Work out where each of the VGM's writes will go
+	xlatBuild();
 
 	// Everything else is okay, I say it's time to load the GD3 tag!
 	populateCurrentGd3();
@@ -1058,92 +1043,54 @@ void populateCurrentGd3(void)
 
 void processCommands(void)
 {
+	uint16_t reg;
+	uint8_t data;
+
 	// Read commands until we are on the same sample as the timer expects.
 	while (dataCurrentSample < tickCounter)
 	{
-		// Get the next command data, but stop processing if it didn't work
-		if (getNextCommandData() != 0)
+		// Get the next command data, but stop processing if it didn't work or the song is over
+		if (readNextCommand() != 0)
 		{
 			break;
 		}
+		// If it's an OPL write, send it off
+		if (decodeCommandWrite(&reg, &data) != 0)
+		{
+			traceSource = commandID;
+			writeOPL(reg, data);
+		}
+	}
+	traceSource = TRACE_SOURCE_PLAYER;
+}
+
+uint8_t readNextCommand(void)
+{
+	// Get the next command data, but stop processing if it didn't work
+	if (getNextCommandData() != 0)
+	{
+		return 1;
+	}
 
-		// If end of song data, check for loop, or end song
-		// Properly formatted VGMs use command 0x66 for this.
-		// If this command is missing, vgmReadBytes via getNextCommandData should have caught that we overran the end of the file.
-		if (commandID == 0x66)
+	// If end of song data, check for loop, or end song
+	// Properly formatted VGMs use command 0x66 for this.
+	// If this command is missing, vgmReadBytes via getNextCommandData should have caught that we overran the end of the file.
+	if (commandID == 0x66)
+	{
+		if (loopCount < loopMax && currentVGMHeader.loopOffset > 0)
 		{
-			if (loopCount < loopMax && currentVGMHeader.loopOffset > 0)
-			{
-				fseek(vgmFilePointer, currentVGMHeader.loopOffset+0x1C, SEEK_SET);
-				fileCursorLocation = currentVGMHeader.loopOffset+0x1C;
-				loopCount++;
-				getNextCommandData();
-			}
-			else
-			{
-				programState = STATE_END_OF_SONG;
-				return;
-			}
+			fseek(vgmFilePointer, currentVGMHeader.loopOffset+0x1C, SEEK_SET);
+			fileCursorLocation = currentVGMHeader.loopOffset+0x1C;
+			loopCount++;
+			getNextCommandData();
 		}
-		// Interpret which command we are looking at - data or wait?
-		switch (commandID)
+		else
 		{
-			// OPL2 write
-			case 0x5A:
-				// Dual-OPL2 on OPL3 hack
-				// First chip (left pan)
-				if (detectedChip == DETECTED_OPL3 && vgmChipType == VGM_DUAL_OPL2)
-				{
-					if ((commandReg & 0xC0) == 0xC0)
-					{
-						// Zero the stereo bits and write new panning
-						commandData = ((commandData & 0x0F) | 0x10);
-					}
-				}
-				writeOPL(commandReg,commandData);
-				break;
-			// OPL1 write
-			case 0x5B:
-				writeOPL(commandReg,commandData);
-				break;
-			// OPL3 write (port 1)
-			case 0x5E:
-				writeOPL(commandReg,commandData);
-				break;
-			// OPL3 write (port 2) - modify destination register en-route to indicate secondary registers.
-			case 0x5F:
-				writeOPL(commandReg+0x100,commandData);
-				break;
-			// Second OPL2 write - modify destination register en-route to indicate secondary registers.
-			case 0xAA:
-				// Dual-OPL2 on OPL3 hack
-				// Modify incoming data if needed to force panning
-				if (detectedChip == DETECTED_OPL3 && vgmChipType == VGM_DUAL_OPL2)
-				{
-					// Second chip (right pan)
-					if ((commandReg & 0xC0) == 0xC0)
-					{
-						// Zero the stereo bits and write new panning
-						commandData = ((commandData & 0x0F) | 0x20);
-					}
-					// Absolutely under no circumstances try to write OPL2 Waveform Select to the OPL3 high block
-					// That will cause the OPL3 to stop outputting sound
-					if (commandReg == 0x01)
-					{
-						break;
-					}
-				}
-				writeOPL(commandReg+0x100,commandData);
-				break;
-			// Second OPL1 write - modify destination register en-route to indicate secondary registers.
-			case 0xAB:
-				writeOPL(commandReg+0x100,commandData);
-				break;
-			default:
-				break;
+			programState = STATE_END_OF_SONG;
+			return 1;
 		}
-
 	}
+	return 0;
 }
 
 uint8_t vgmReadBytes(uint16_t numBytes)
@@ -17,6 +17,8 @@
 #ifndef VGMSLAP_VGM_H
 #define VGMSLAP_VGM_H
 
+#include <stdio.h>
+
 #include "types.h"
 #include "deps/zlib.h"
 
@@ -24,12 +26,15 @@
 // Function declarations
 ///////////////////////////////////////////////////////////////////////////////
 
+uint8_t decodeCommandWrite(uint16_t* reg, uint8_t* data);	// Turn the current command into the final OPL register/data to write (returns 0 if it isn't an OPL write)
+void fillEventQueue(void);					// Decode upcoming commands into the event queue for ISR write mode
 uint8_t getNextCommandData(void);			// Move through the file based on the commands encountered &
 											// load in data for supported commands, to be processed during playback.
 wchar_t* getNextGd3String(void);			// Extract the next null terminated string from the overall GD3 tag
 uint8_t loadVGM(void);						// Read from the specified VGM file and performs some validity checks
 void populateCurrentGd3(void);				// Calls getNextGd3String to populate each GD3 tag value
 void processCommands(void);					// Called during the timer loop to process the next VGM command
+uint8_t readNextCommand(void);				// Reads the next command, handling loops and end of song (returns 1 if there is nothing more to play)
 uint8_t vgmReadBytes(uint16_t numBytes);	// Reads in how many bytes we need for the next VGM command.
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -19,20 +19,33 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "autodiv.h"
+#include "bus.h"
+#include "cells.h"
+#include "decode.h"
+#include "fifo.h"
+#include "golden.h"
 #include "opl.h"
 #include "playlist.h"
+#include "render.h"
+#include "resample.h"
 #include "settings.h"
+#include "stream.h"
 #include "timer.h"
+#include "trace.h"
+#include "txtgfx.h"
 #include "txtmode.h"
 #include "ui.h"
 #include "vgm.h"
 #include "vgmslap.h"
+#include "xlat.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 // Initialize variables
 ///////////////////////////////////////////////////////////////////////////////
 
 ProgramState programState = STATE_INITIALIZATION;
+oplSnapshot pauseSnapshot;
 char* fileName;
 FILE *initialFilePointer;
 
@@ -42,10 +55,106 @@ FILE *initialFilePointer;
 
 int main(int argc, char** argv)
 {
-	uint16_t i;
+	uint32_t stageStart;
+	uint32_t lateness;
+	uint32_t processTicks;
+	uint32_t drawTicks;
+	uint32_t barTicks;
+	uint8_t qualityOverride = 0xFF;	// Set from the command line, if it was there
+	uint8_t resampleTest = FALSE;
+	char* streamFileName = NULL;	// Where live emulator output goes, if anywhere
+	uint8_t traceReplayMode = 0xFF;	// Set if a trace is being played back instead of a VGM
+	uint8_t goldenMode = FALSE;		// Set if checking against golden renders
+	uint8_t goldenUpdate = FALSE;	// Set if the golden renders are being replaced with fresh ones
+	char* goldenThresholdFile = NULL;	// Where the golden check's thresholds come from, if anywhere
 	
 	// Check for arguments
-		if (argc != 2)
+		// Either render mode can have the emulator quality tacked on the end, which beats whatever the config file says
+		if (argc > 3 && (strcmp(argv[argc - 1], "/FAST") == 0 || strcmp(argv[argc - 1], "/fast") == 0))
+		{
+			qualityOverride = 1;
+			argc--;
+		}
+		else if (argc > 3 && (strcmp(argv[argc - 1], "/ACCURATE") == 0 || strcmp(argv[argc - 1], "/accurate") == 0))
+		{
+			qualityOverride = 0;
+			argc--;
+		}
+		// Render to WAV: VGMSLAP /W <VGM file> <WAV file>
+		if (argc == 4 && (strcmp(argv[1], "/W") == 0 || strcmp(argv[1], "/w") == 0))
+		{
+			renderMode = TRUE;
+		}
+		// One WAV per channel: VGMSLAP /S <VGM file> <file name prefix>
+		else if (argc == 4 && (strcmp(argv[1], "/S") == 0 || strcmp(argv[1], "/s") == 0))
+		{
+			renderMode = TRUE;
+			renderStems = TRUE;
+			renderStemPrefix = argv[3];
+		}
+		// Resampler frequency response and speed: VGMSLAP /R
+		else if (argc == 2 && (strcmp(argv[1], "/R") == 0 || strcmp(argv[1], "/r") == 0))
+		{
+			renderMode = TRUE;
+			resampleTest = TRUE;
+		}
+		// Check the emulator's shortcuts against the full thing: VGMSLAP /C <VGM file>
+		else if (argc == 3 && (strcmp(argv[1], "/C") == 0 || strcmp(argv[1], "/c") == 0))
+		{
+			renderMode = TRUE;
+			renderCheck = TRUE;
+		}
+		// Check renders against known-good ones: VGMSLAP /G <golden file> [threshold file] [/UPDATE]
+		else if ((argc >= 3 && argc <= 5) && (strcmp(argv[1], "/G") == 0 || strcmp(argv[1], "/g") == 0))
+		{
+			renderMode = TRUE;
+			goldenMode = TRUE;
+			// /UPDATE always goes last, and anything between it and the golden file is the threshold file
+			if (argc >= 4 && (strcmp(argv[argc - 1], "/UPDATE") == 0 || strcmp(argv[argc - 1], "/update") == 0))
+			{
+				goldenUpdate = TRUE;
+				if (argc == 5)
+				{
+					goldenThresholdFile = argv[3];
+				}
+			}
+			else if (argc == 4)
+			{
+				goldenThresholdFile = argv[3];
+			}
+			else if (argc == 5)
+			{
+				killProgram(ERROR_NO_ARGUMENTS);
+			}
+		}
+		// Play back a register trace: VGMSLAP /T <trace file> [/MAX, /LIST or /DRAW]
+		else if ((argc == 3 || argc == 4) && (strcmp(argv[1], "/T") == 0 || strcmp(argv[1], "/t") == 0))
+		{
+			renderMode = TRUE;
+			traceReplayMode = TRACE_REPLAY_REALTIME;
+			if (argc == 4 && (strcmp(argv[3], "/MAX") == 0 || strcmp(argv[3], "/max") == 0))
+			{
+				traceReplayMode = TRACE_REPLAY_MAX;
+			}
+			else if (argc == 4 && (strcmp(argv[3], "/LIST") == 0 || strcmp(argv[3], "/list") == 0))
+			{
+				traceReplayMode = TRACE_REPLAY_LIST;
+			}
+			else if (argc == 4 && (strcmp(argv[3], "/DRAW") == 0 || strcmp(argv[3], "/draw") == 0))
+			{
+				traceReplayMode = TRACE_REPLAY_DRAW;
+			}
+			else if (argc == 4)
+			{
+				killProgram(ERROR_NO_ARGUMENTS);
+			}
+		}
+		// Play with the emulator and send what it makes to a file or device: VGMSLAP <VGM file> /O <output>
+		else if (argc == 4 && (strcmp(argv[2], "/O") == 0 || strcmp(argv[2], "/o") == 0))
+		{
+			streamFileName = argv[3];
+		}
+		else if (argc != 2)
 		{
 				
 				killProgram(ERROR_NO_ARGUMENTS);
@@ -59,58 +168,127 @@ int main(int argc, char** argv)
 	printf("VGMSlap! %s by Wafflenet\n", VGMSLAP_VERSION);
 	
 	// Get path of settings file (we want to be sure that even if it's called from another directory, that the CFG file in the EXE folder is used)
-	strncpy(settings.filePath, argv[0], sizeof(settings.filePath));
-	for (i = sizeof(settings.filePath); i > 0; i--)
-	{
-		// Search string from end until the first \ is found, then insert the cfg file name after that.
-		if (settings.filePath[i] == '\\')
-		{
-			settings.filePath[i+1] = '\0';
-			strcat(settings.filePath, "VGMSLAP.CFG");
-			break;
-		}
-	}
+	makeExePath(settings.filePath, argv[0], "VGMSLAP.CFG");
+	// Same deal for the log file and the trace file
+	makeExePath(settings.logPath, argv[0], "VGMSLAP.LOG");
+	makeExePath(settings.tracePath, argv[0], "VGMSLAP.TRC");
 	
 	// Populate default settings (will be overridden from config file, if present)
 	settings.oplBase = CONFIG_DEFAULT_PORT;
 	settings.frequencyDivider = CONFIG_DEFAULT_DIVIDER;
+	settings.autoDivider = CONFIG_DEFAULT_AUTODIVIDER;
 	settings.loopCount = CONFIG_DEFAULT_LOOPS;
 	settings.struggleBus = CONFIG_DEFAULT_STRUGGLE;
+	settings.isrWrite = CONFIG_DEFAULT_ISRWRITE;
+	settings.emulator = CONFIG_DEFAULT_EMULATOR;
+	settings.skipIdle = CONFIG_DEFAULT_SKIPIDLE;
+	settings.quality = CONFIG_DEFAULT_QUALITY;
+	settings.outputRate = CONFIG_DEFAULT_RATE;
+	settings.resampleTaps = CONFIG_DEFAULT_TAPS;
+	settings.latency = CONFIG_DEFAULT_LATENCY;
+	settings.trace = CONFIG_DEFAULT_TRACE;
+	settings.goldenSlow = CONFIG_DEFAULT_GOLDSLOW;
+	settings.drawTime = CONFIG_DEFAULT_DRAWTIME;
 	
 	// Read settings from config file
 	setConfig();
+	if (qualityOverride != 0xFF)
+	{
+		settings.quality = qualityOverride;
+	}
 	
 	oplBaseAddr = settings.oplBase;
 	playbackFrequencyDivider = settings.frequencyDivider;
 	loopMax = settings.loopCount;
+
+	// Every value the channel table can show, ready to copy straight to the screen
+	buildCellTemplates();
 	
+	// Headless render - no card, no timer, no screen.  Do it and get out.
+	if (renderMode == TRUE)
+	{
+		if (traceReplayMode != 0xFF)
+		{
+			traceReplay(argv[2], traceReplayMode);
+		}
+		else if (goldenMode == TRUE)
+		{
+			// Batch files can check ERRORLEVEL to see if anything failed
+			if (goldenThresholdFile != NULL)
+			{
+				goldenReadThreshold(goldenThresholdFile);
+			}
+			if (goldenRun(argv[2], goldenUpdate) == TRUE)
+			{
+				return 1;
+			}
+		}
+		else if (resampleTest == TRUE)
+		{
+			// Whatever rate is in the config, or 44100hz if it's set to native
+			if (settings.outputRate == 0)
+			{
+				settings.outputRate = 44100;
+			}
+			resampleReport(settings.outputRate);
+		}
+		else if (renderStems == TRUE)
+		{
+			renderVGM(argv[2], NULL);
+		}
+		else
+		{
+			// A playlist gets every song in it rendered (or checked), one after another
+			fileName = argv[2];
+			if (playlistDetect() == TRUE)
+			{
+				renderPlaylist(renderCheck == TRUE ? NULL : argv[3]);
+			}
+			else if (renderCheck == TRUE)
+			{
+				renderVGM(argv[2], NULL);
+			}
+			else
+			{
+				renderVGM(argv[2], argv[3]);
+			}
+		}
+		return 0;
+	}
+	
+	// Live output needs the emulator, and writes that go out on the emulator's own clock rather than the timer's
+	if (streamFileName != NULL)
+	{
+		if (settings.emulator == 0)
+		{
+			settings.emulator = DETECTED_OPL3;
+		}
+		settings.isrWrite = 0;
+	}
+
+	// Recording a trace from the start means detection gets recorded too.  The timer interrupt can't write to a file, so ISR write mode is off while recording.
+	if (settings.trace == 1)
+	{
+		settings.isrWrite = 0;
+		traceOpen(settings.tracePath);
+	}
+
 	// Detect the OPL chip
 	detectOPL();
-	
-	// Load initially requested file
-	errno = 0;
-	initialFilePointer = fopen(fileName,"rb");
-	if (initialFilePointer == NULL)
+	if (streamFileName != NULL)
 	{
-		killProgram(ERROR_FILE_MISSING);
+		streamOpen(streamFileName);
 	}
+	
+	// Load initially requested file
 	// Did we load a playlist, or a single VGM?
-	fgets(playlistLineBuffer,sizeof(playlistLineBuffer),initialFilePointer);
-	// It's a playlist
-	if (strncmp(playlistLineBuffer,"#VGMLIST", 8) == 0)
+	if (playlistDetect() == TRUE)
 	{
 		printf("Playlist detected!\n");
 		playlistMode = TRUE;
 		playlistLineNumber = 1;
 	}
 	
-	// Close "initial file", we're done with it
-	// At this point we've validated that it is in fact a file already
-	if (initialFilePointer != NULL)
-	{
-		fclose(initialFilePointer);
-	}
-	
 	// If playlist was found, open playlist, jump to playlist handler and load first song
 	if (playlistMode == TRUE)
 	{
@@ -123,6 +301,13 @@ int main(int argc, char** argv)
 		vgmFileName = fileName;	
 	}
 	
+	// Automatic divider needs to know how fast this machine is before our timer starts eating into it
+	if (settings.autoDivider == 1)
+	{
+		printf("Measuring CPU speed for automatic DIVIDER...\n");
+		autoDividerCalibrate();
+	}
+
 	// Start playback incl. VGM load and timer init
 	initPlayback();
 
@@ -131,7 +316,38 @@ int main(int argc, char** argv)
 		// If playing then we are in the main logic loop.  Commands will be processed, input will be read, and the screen will be refreshed.
 		if (programState == STATE_PLAYING)
 		{
-			processCommands();
+			// How far behind the timer the next command is - if we're keeping up this should stay close to zero
+			lateness = 0;
+			if (tickCounter > dataCurrentSample)
+			{
+				lateness = tickCounter - dataCurrentSample;
+			}
+			processTicks = 0;
+			drawTicks = 0;
+			barTicks = 0;
+			stageStart = tickCounter;
+
+			// In ISR write mode the timer interrupt sends the writes, we just keep its queue topped up
+			if (settings.isrWrite == 1)
+			{
+				fillEventQueue();
+			}
+			else
+			{
+				processCommands();
+			}
+			// Live emulator output: make audio up to where the commands have got to, and send out whatever is due
+			if (streamActive == TRUE)
+			{
+				streamSynthesize(dataCurrentSample);
+				streamSink();
+			}
+			// Keep oplStatus up with the writes as they go, so drawing only has to look at what changed
+			if (settings.struggleBus == 0)
+			{
+				decodeOPLChanges();
+			}
+			processTicks = tickCounter - stageStart;
 			
 			// Press a key to quit
 			// Todo: How to force the keyboard to respond if the CPU is overloaded due to playing a busy VGM on underspecced hardware?  Keyboard interrupt is getting missed.  Also keypress gets passed to next program (command, file manager, etc) after quit.  Detect release before acting?
@@ -140,24 +356,55 @@ int main(int argc, char** argv)
 			// Refresh screen
 			if (settings.struggleBus == 0)
 			{
-				// If a register value changed, requestScreenDraw gets set so that the new table values are drawn
-				if (requestScreenDraw > 0)
-				{
-					drawChannelTable();
-					
-				}
-				// Channel bars at the bottom are refreshed at a slower rate
+				// Everything is drawn once per screen refresh - drawing more often than the monitor can show it just holds up the music.
+				// In between, decodeOPLChanges collects the register changes (marking them in decodeChannelChanges), so a channel written a hundred times is still only drawn once.
 				if (screenCounter > VGA_REFRESH_TICKS)
 				{
+					// If we got here more than a refresh late, the ones in between never got drawn
+					drawFramesSkipped += (screenCounter / VGA_REFRESH_TICKS) - 1;
+					// If a register value changed, requestScreenDraw gets set so that the new table values are drawn.
+					// It only gets DRAWTIME percent of the refresh, and picks up where it left off next time if that's not enough.
+					if (requestScreenDraw > 0)
+					{
+						stageStart = tickCounter;
+						drawChannelTable(((uint32_t)VGA_REFRESH_TICKS * settings.drawTime) / 100);
+						drawTicks = tickCounter - stageStart;
+						drawFramesDrawn++;
+					}
+					// Channel bars at the bottom
+					stageStart = tickCounter;
 					updateLevelBars();
+					barTicks = tickCounter - stageStart;
 					screenCounter = 0;
 				}
 			}
+			// Everything drawn this time around (including key presses, even in struggle bus mode) goes out to the screen in one go
+			stageStart = tickCounter;
+			flushTextScreen((uint16_t far *)textScreen);
+			drawTicks += tickCounter - stageStart;
+
+			// Keep track of how well we're keeping up, and raise the divider if we really can't
+			if (settings.autoDivider == 1)
+			{
+				autoDividerPass(lateness, processTicks, drawTicks, barTicks);
+			}
 
 		}
 		// Things to do when we run out of song
 		else if (programState == STATE_END_OF_SONG)
 		{
+			// Stop the timer interrupt from sending anything left in the queue (skipped tracks)
+			eventQueueActive = FALSE;
+
+			// Use what we learned from this song to pick the divider for the next one
+			if (settings.autoDivider == 1)
+			{
+				autoDividerRetune();
+			}
+
+			// Get the rest of this song's audio out before the chip gets reset
+			streamFinish();
+
 			// Free loaded file pointer
 			fclose(vgmFilePointer);
 			
@@ -165,7 +412,7 @@ int main(int argc, char** argv)
 			resetOPL();
 			if (settings.struggleBus == 0)
 			{
-				drawChannelTable();
+				drawChannelTable(0);
 			}
 			
 			// Load new VGM and then restart playback
@@ -206,6 +453,9 @@ int main(int argc, char** argv)
 
 void initPlayback(void)
 {
+	// Trace timestamps carry on from the last song
+	traceNewSong();
+
 	// Set timer back to normal - reduces loading/decompression performance if we are still processing interrupts
 	if (fastTickRate != 0)
 	{
@@ -255,7 +505,7 @@ void initPlayback(void)
 	// This allows use of additional channels and turns on panning so we can hear it
 	// When the program supports multiple files in a session, this will be moved to pre-playback init
 	// Btw, playback will sound right in Dosbox regardless of this, but breaks on real hardware or 86Box
-	if (detectedChip == DETECTED_OPL3 && vgmChipType == VGM_DUAL_OPL2)
+	if (xlatOPL3Mode == TRUE)
 	{
 		writeOPL(0x105,0x01);
 	}
@@ -263,20 +513,84 @@ void initPlayback(void)
 	// Draw initial OPL state
 	if (settings.struggleBus == 0)
 	{
-		drawChannelTable();
+		drawChannelTable(0);
 	}
+	flushTextScreen((uint16_t far *)textScreen);
 	
 	// Set interrupt timer if it hasn't already been done
 	if (fastTickRate == 0)
 	{
 		initTimer(playbackFrequency);
+		// See how much of the CPU the interrupt takes at this divider
+		if (settings.autoDivider == 1)
+		{
+			autoDividerMeasureISR();
+		}
 	}
 	
 	// Reset time counter and start playback!!
+	// The event queue is emptied before the counter is reset so the interrupt can't send anything from the previous song
+	resetEventQueue();
 	tickCounter = 0;
+	timerPaused = FALSE;
+	if (streamFilePointer != NULL)
+	{
+		streamStart();
+	}
+	if (settings.isrWrite == 1)
+	{
+		eventQueueActive = TRUE;
+	}
+	if (settings.autoDivider == 1)
+	{
+		autoDividerResetStats();
+	}
 	programState = STATE_PLAYING;
 }
 
+void togglePause(void)
+{
+	if (timerPaused == FALSE)
+	{
+		// Stop the clock first, so the timer interrupt can't sneak any ISR writes in between the snapshot and the mute
+		timerPaused = TRUE;
+		snapshotOPL(&pauseSnapshot);
+		muteOPL();
+		drawStringAtPosition("PAUSED",45,0,COLOR_YELLOW,COLOR_BLUE);
+	}
+	else
+	{
+		// Put the chip back and let the clock run again.  The song carries on from exactly where it stopped, since tickCounter never moved.
+		restoreOPL(&pauseSnapshot);
+		timerPaused = FALSE;
+		drawStringAtPosition("      ",45,0,COLOR_WHITE,COLOR_BLUE);
+	}
+}
+
+void makeExePath(char* path, char* exeName, char* fileName)
+{
+	int16_t i;
+
+	// strncpy won't terminate it if argv[0] fills the whole buffer
+	strncpy(path, exeName, PATH_MAX);
+	path[PATH_MAX - 1] = '\0';
+	// Search string from end until the first \ is found, then insert the file name after that
+	for (i = (int16_t)strlen(path) - 1; i >= 0; i--)
+	{
+		if (path[i] == '\\')
+		{
+			break;
+		}
+	}
+	// No folder in there at all (or no room left after it) means the current one
+	if (i >= 0 && (i + 1 + strlen(fileName)) >= PATH_MAX)
+	{
+		i = -1;
+	}
+	path[i + 1] = '\0';
+	strcat(path, fileName);
+}
+
 void killProgram(ProgramExitCode errorCode)
 {
 	// First, perform cleanup actions before closing
@@ -304,13 +618,24 @@ void killProgram(ProgramExitCode errorCode)
 	{
 		fclose(playlistFilePointer);
 	}
+	streamClose();
+	traceClose();
 	// Reset OPL but only if one was detected
 	if (detectedChip != DETECTED_NONE)
 	{
 		resetOPL();
 	}
-	clearTextScreen();
-	setVideoMode(TEXT_80X25);
+	busClose();
+	if (renderFilePointer != NULL)
+	{
+		fclose(renderFilePointer);
+	}
+	// Render mode never touched the video mode, so leave whatever's on screen alone
+	if (renderMode == FALSE)
+	{
+		clearTextScreen();
+		setVideoMode(TEXT_80X25);
+	}
 	
 	// Print error code, if necessary
 	switch (errorCode)
@@ -320,9 +645,51 @@ void killProgram(ProgramExitCode errorCode)
 			printf("by Wafflenet, 2023-2024\n");
 			printf("www.wafflenet.com\n");
 			printf("\n");
+			if (settings.isrWrite == 1)
+			{
+				printf("ISR write mode: %u budget overruns, %u deferred ticks, %u queue stalls\n", eventQueueBudgetOverruns, eventQueueLockDeferrals, eventQueueFullStalls);
+			}
+			if (oplResetSkipped > 0)
+			{
+				printf("OPL resets: %lu writes sent, %lu skipped\n", oplResetWrites, oplResetSkipped);
+			}
+			if (oplRestoreWrites > 0)
+			{
+				printf("Last resume from pause: %u writes\n", oplRestoreWrites);
+			}
+			if (busAccesses > 0)
+			{
+				printf("OPL bus: %lu port accesses, %lu had to wait for the chip\n", busAccesses, busWaits);
+			}
+			if (drawFramesDrawn > 0)
+			{
+				printf("Channel table: %lu frames drawn, %lu skipped, %lu ran out of time\n", drawFramesDrawn, drawFramesSkipped, drawBudgetOverruns);
+			}
+			if (textCellsDrawn > 0)
+			{
+				printf("Screen: %lu cells drawn, %lu changed, %lu copied to video memory\n", textCellsDrawn, textCellsChanged, textCellsFlushed);
+			}
+			if (traceWrites > 0)
+			{
+				printf("Trace: %lu writes recorded to %s\n", traceWrites, settings.tracePath);
+			}
+			if (streamFramesWritten > 0)
+			{
+				printf("Emulator output: %lu seconds, %lu underruns, %lu overruns\n", streamFramesWritten / renderOutRate, streamUnderruns, streamOverruns);
+			}
 			break;
 		case ERROR_NO_ARGUMENTS:
 			printf("Usage: VGMSLAP <FILENAME>\n");
+			printf("       VGMSLAP <FILENAME> /O <OUTPUT>     (play with the emulator into a file)\n");
+			printf("       VGMSLAP /W <VGM FILE> <WAV FILE>   (render to WAV)\n");
+			printf("       VGMSLAP /W <PLAYLIST> <FOLDER>     (render a whole playlist)\n");
+			printf("       VGMSLAP /S <VGM FILE> <PREFIX>     (render each channel to its own WAV)\n");
+			printf("       VGMSLAP /C <VGM FILE>              (check emulator shortcuts)\n");
+			printf("       Add /FAST or /ACCURATE to any of these to pick the emulator quality\n");
+			printf("       VGMSLAP /R                         (test the resampler)\n");
+			printf("       VGMSLAP /T <TRACE FILE> [/MAX|/LIST|/DRAW] (play back a register trace)\n");
+			printf("       VGMSLAP /G <GOLDEN FILE> [THRESHOLD FILE] [/UPDATE]\n");
+			printf("                                          (check renders against known-good ones)\n");
 			break;
 		case ERROR_FILE_MISSING:
 			printf("Huh?  That file doesn't exist...");
@@ -365,6 +732,33 @@ void killProgram(ProgramExitCode errorCode)
 			printf("%s", settings.tempPath);
 			perror("");
 			break;
+		case ERROR_RENDER_OUTPUT_FAILED:
+			printf("Couldn't create the WAV file!\n");
+			printf("%s", renderFileName);
+			perror("");
+			break;
+		case ERROR_RENDER_NO_MEMORY:
+			printf("Not enough memory to render!\n");
+			break;
+		case ERROR_TRACE_OUTPUT_FAILED:
+			printf("Couldn't create the trace file!\n");
+			printf("%s", settings.tracePath);
+			perror("");
+			break;
+		case ERROR_TRACE_BAD_FILE:
+			printf("This is not a VGMSlap trace file!\n");
+			break;
+		case ERROR_RENDER_STEMS_UNSUPPORTED:
+			printf("Stems can't be rendered for dual OPL3!\n");
+			break;
+		case ERROR_GOLDEN_FILE_FAILED:
+			printf("Couldn't open the golden file!\n");
+			perror("");
+			break;
+		case ERROR_GOLDEN_THRESHOLD_FAILED:
+			printf("Couldn't open the golden threshold file!\n");
+			perror("");
+			break;
 	}
 	exit(errorCode);
 }
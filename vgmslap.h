@@ -19,6 +19,7 @@
 
 #include <stdio.h>
 
+#include "opl.h"
 #include "types.h"
 
 #define VGMSLAP_VERSION "R4"
@@ -29,6 +30,8 @@
 
 int main(int argc, char** argv);				// Main program loop
 void initPlayback(void);						// Prepare for and start playback state
+void togglePause(void);							// Mute the chip and stop the song's clock, or pick back up where it left off
+void makeExePath(char* path, char* exeName, char* fileName);	// Put a file in the same folder as the EXE (path is PATH_MAX long)
 void killProgram(ProgramExitCode errorCode);    // End program with message/error code
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -37,6 +40,7 @@ void killProgram(ProgramExitCode errorCode);    // End program with message/erro
 
 // General program vars
 extern ProgramState programState;	// Controls current state of program (init, main loop, exit, etc)
+extern oplSnapshot pauseSnapshot;	// Chip state from just before pausing, to put back on resume
 
 // File-related vars
 extern char* fileName;				// Filename from argument
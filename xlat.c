@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// XLAT.C - Translate the VGM's chip writes into writes for the chip we've got
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include "opl.h"
+#include "vgm.h"
+#include "xlat.h"
+
+///////////////////////////////////////////////////////////////////////////////
+// Initialize variables
+///////////////////////////////////////////////////////////////////////////////
+
+xlatEntry xlatTable[XLAT_SOURCES][256];
+uint8_t xlatCommandChip[256];
+uint8_t xlatOPL3Mode = FALSE;
+
+// Rows are VgmChipType, columns are OplDetectedType (none, OPL2, dual OPL2, OPL3, dual OPL3).
+// A single chip song on a dual OPL2 goes to base+8, which writes to both chips at once so it plays in stereo.
+// Dual OPL3 only exists in the emulator, so the port doesn't matter there.
+const uint8_t xlatBaseOffset[8][5] = {
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED},	// No OPL
+	{XLAT_UNSUPPORTED, 0,                8,                0,                0},					// OPL1
+	{XLAT_UNSUPPORTED, 0,                8,                0,                0},					// OPL2
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, 0,                0},					// OPL3
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, 0,                0,                0},					// Dual OPL1
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, 0,                0,                0},					// Dual OPL2
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, 0,                0,                0},					// OPL1 + OPL2
+	{XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, XLAT_UNSUPPORTED, 0}					// Dual OPL3
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions
+///////////////////////////////////////////////////////////////////////////////
+
+void xlatBuild(void)
+{
+	uint16_t i;
+	uint8_t chip;
+
+	// Which commands write to which of the VGM's chips.  Anything not listed here isn't an OPL write.
+	memset(xlatCommandChip, XLAT_NOT_OPL, sizeof(xlatCommandChip));
+	xlatCommandChip[0x5A] = 0;	// OPL2
+	xlatCommandChip[0x5B] = 0;	// OPL1
+	xlatCommandChip[0x5E] = 0;	// OPL3 (port 1)
+	xlatCommandChip[0x5F] = 1;	// OPL3 (port 2)
+	xlatCommandChip[0xAA] = 1;	// Second OPL2
+	xlatCommandChip[0xAB] = 1;	// Second OPL1
+	// OPL1 + OPL2 - the OPL1 gets treated as the second chip
+	if (vgmChipType == VGM_OPL1_OPL2)
+	{
+		xlatCommandChip[0x5B] = 1;
+	}
+	// Dual OPL3 - the second OPL3 gets registers 0x200-0x3FF
+	if (vgmChipType == VGM_DUAL_OPL3)
+	{
+		xlatCommandChip[0xAE] = 2;	// Second OPL3 (port 1)
+		xlatCommandChip[0xAF] = 3;	// Second OPL3 (port 2)
+	}
+
+	// Start off with everything going straight through, each register set to the next 0x100 registers up
+	for (chip = 0; chip < XLAT_SOURCES; chip++)
+	{
+		for (i = 0; i < 256; i++)
+		{
+			xlatTable[chip][i].reg = i + (chip * 0x100);
+			xlatTable[chip][i].andMask = 0xFF;
+			xlatTable[chip][i].orMask = 0x00;
+			xlatTable[chip][i].drop = FALSE;
+		}
+	}
+
+	// Dual chip songs on an OPL3: the second chip goes to the high bank, and each chip gets its own speaker
+	xlatOPL3Mode = FALSE;
+	if ((detectedChip == DETECTED_OPL3 || detectedChip == DETECTED_DUAL_OPL3) && (vgmChipType == VGM_DUAL_OPL1 || vgmChipType == VGM_DUAL_OPL2 || vgmChipType == VGM_OPL1_OPL2))
+	{
+		for (i = 0xC0; i <= 0xC8; i++)
+		{
+			// Zero the stereo bits and write new panning - first chip left, second chip right
+			xlatTable[0][i].andMask = 0x0F;
+			xlatTable[0][i].orMask = 0x10;
+			xlatTable[1][i].andMask = 0x0F;
+			xlatTable[1][i].orMask = 0x20;
+		}
+		// Absolutely under no circumstances try to write OPL2 Waveform Select to the OPL3 high block
+		// That will cause the OPL3 to stop outputting sound
+		xlatTable[1][0x01].drop = TRUE;
+		// Same goes for the second chip's timer control - on the OPL3 high bank that's 0x104, which would turn on 4-op mode
+		xlatTable[1][0x04].drop = TRUE;
+		// The high bank (and the panning) only work with the NEW bit on
+		xlatOPL3Mode = TRUE;
+	}
+}
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////
+// __      _______ __  __  _____ _             _
+// \ \    / / ____|  \/  |/ ____| |           | |
+//  \ \  / / |  __| \  / | (___ | | __ _ _ __ | |
+//   \ \/ /| | |_ | |\/| |\___ \| |/ _` | '_ \| |         by Wafflenet
+//    \  / | |__| | |  | |____) | | (_| | |_) |_|       www.wafflenet.com
+//     \/   \_____|_|  |_|_____/|_|\__,_| .__/(_)
+//      (VGM Silly Little AdLib Player) | |
+//                                      |_|
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+// XLAT.H - Translate the VGM's chip writes into writes for the chip we've got
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef VGMSLAP_XLAT_H
+#define VGMSLAP_XLAT_H
+
+#include "types.h"
+
+// Marks a command that isn't an OPL write in xlatCommandChip
+#define XLAT_NOT_OPL 0xFF
+
+// Marks a VGM/detected chip combination that can't be played in xlatBaseOffset
+#define XLAT_UNSUPPORTED 0xFF
+
+// Register sets a VGM can write to: first chip (or OPL3 port 0), second chip (or OPL3 port 1), and the second OPL3's two ports
+#define XLAT_SOURCES 4
+
+///////////////////////////////////////////////////////////////////////////////
+// Struct declarations
+///////////////////////////////////////////////////////////////////////////////
+
+// Where one register of one of the VGM's chips ends up
+typedef struct
+{
+	uint16_t reg;		// Register to write on our chip (0x100 and up for the second chip / OPL3 high bank)
+	uint8_t andMask;	// Data is ANDed with this...
+	uint8_t orMask;		// ...then ORed with this
+	uint8_t drop;		// Set if this write must never reach our chip
+} xlatEntry;
+
+///////////////////////////////////////////////////////////////////////////////
+// Function declarations
+///////////////////////////////////////////////////////////////////////////////
+
+void xlatBuild(void);		// Fill in the tables for the VGM just loaded and the chip we detected
+
+///////////////////////////////////////////////////////////////////////////////
+// Variable declarations
+///////////////////////////////////////////////////////////////////////////////
+
+extern xlatEntry xlatTable[XLAT_SOURCES][256];	// Translation for every register of each of the VGM's register sets
+extern uint8_t xlatCommandChip[256];	// Which of the VGM's register sets each command writes to, or XLAT_NOT_OPL
+extern uint8_t xlatOPL3Mode;			// Set if the translation needs the OPL3's NEW bit turned on before playing
+extern const uint8_t xlatBaseOffset[8][5];	// Offset from the configured port for each VgmChipType and OplDetectedType, or XLAT_UNSUPPORTED
+
+#endif